@@ -34,8 +34,12 @@
  *  Pin 34 (Int)                        Pin 31 - GPIO 6 - Optional
  *  Pin 32 (DSDA/TDI)       Pin 13      Pin 3 - GPIO 2 (SDA) - Debug
  *  Pin 29 (DSCL/TCK)       Pin 14      Pin 5 - GPIO 3 (SCL) - Debug
+ *
+ *  If IPL_USE_INTPIN_EDGE is defined, the INT pin is requested via the GPIO character device
+ *  instead of sysfs, so that the falling edge can be waited for by poll().
  */
 
+#define _GNU_SOURCE /* ppoll() */
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -54,6 +58,24 @@
 #include <linux/i2c-dev.h>
 #include <fcntl.h>
 #include <linux/limits.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+#ifdef IPL_USE_I2CDEV
+#include "ipl_i2cdev.h"
+#endif
+#if defined IPL_USE_INICTRANSFER && !defined IPL_USE_I2CDEV
+#error "hw_raspi.c: IPL_USE_INICTRANSFER is served by the i2c-dev transport, IPL_USE_I2CDEV needs to be defined."
+#endif
+#if defined IPL_USE_INICBATCH && !defined IPL_USE_I2CDEV
+#error "hw_raspi.c: IPL_USE_INICBATCH is served by the i2c-dev transport, IPL_USE_I2CDEV needs to be defined."
+#endif
+#ifdef IPL_USE_GPIODEV
+#include "ipl_gpiodev.h"
+#endif
+#ifdef IPL_USE_INTPIN_EDGE
+#include <poll.h>
+#include <linux/gpio.h>
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -65,6 +87,10 @@
 #define BOOT_PIN            "18"   /* GPIO 18 */
 #define INT_PIN             "6"    /* GPIO 6  */
 #define I2C_CDEV            "/dev/i2c-1"
+#define GPIO_CDEV           "/dev/gpiochip0"
+#define INT_LINE            6U     /* GPIO 6, line offset on GPIO_CDEV */
+#define RESET_LINE          5U     /* GPIO 5, line offset on GPIO_CDEV */
+#define BOOT_LINE           18U    /* GPIO 18, line offset on GPIO_CDEV */
 
 /* HW specific */
 #define HW_INIC_I2C_ADDR    (0x40>>1)      /* 0x20 */
@@ -103,13 +129,23 @@
 
 uint16_t Hw_GetTime(void);
 char     Hw_GetKey(void);
+#ifdef IPL_USE_TRANSPORT
+uint8_t  Hw_SetupTransport(void);
+#endif
 
 static bool WriteCharactersToFile( const char *pFileName, const char *pString );
+#ifndef IPL_USE_INTPIN_EDGE
 static bool ReadFromFile( const char *pFileName, char *pString, uint16_t bufferLen );
+#endif
+#ifndef IPL_USE_GPIODEV
 static bool ExistsDevice( const char *pDeviceName );
 static bool WaitForDevice( const char *pDeviceName );
+#endif
 static void SetI2CAddress(uint8_t addr);
 static const char *GetErrnoString();
+#if defined IPL_USE_INTPIN_EDGE && !defined IPL_USE_GPIODEV
+static bool RequestIntLine(void);
+#endif
 
 int getch();
 int kbhit(void);
@@ -121,6 +157,9 @@ int kbhit(void);
 
 static int m_fh = -1;
 static uint8_t m_addr = 0xFF;
+#ifdef IPL_USE_INTPIN_EDGE
+static int m_intfh = -1;
+#endif
 static FILE* tracefile = NULL;
 
 
@@ -140,12 +179,15 @@ uint8_t Ipl_InicDriverOpen(void)
     if (hfile == NULL) return 11U;
     tracefile = hfile;
 
+#ifndef IPL_USE_I2CDEV
     if ((m_fh = open(I2C_CDEV, O_RDWR)) < 0)
     {
         printf("Failed to open the i2c bus, error=%s\n", GetErrnoString());
         return 1U;
     }
+#endif
 
+#ifndef IPL_USE_GPIODEV
     if (!WriteCharactersToFile(GPIO_EXPORT, RESET_PIN)) 
 	{
 		printf("Failed to access RESET_PIN, error=%s\n", GetErrnoString());
@@ -156,11 +198,19 @@ uint8_t Ipl_InicDriverOpen(void)
 		printf("Failed to access BOOT_PIN, error=%s\n", GetErrnoString());
 		return 3U;
 	}
+#ifdef IPL_USE_INTPIN_EDGE
+    if (!RequestIntLine())
+    {
+        printf("Failed to request INT_LINE, error=%s\n", GetErrnoString());
+        return 4U;
+    }
+#else
     if (!WriteCharactersToFile(GPIO_EXPORT, INT_PIN)) 
 	{
 		printf("Failed to access INT_PIN, error=%s\n", GetErrnoString());
 		return 4U;
 	}
+#endif
 
     if (!WaitForDevice(RESET_PIN_FOLDER)) 
 	{
@@ -184,6 +234,7 @@ uint8_t Ipl_InicDriverOpen(void)
 		return 8U;
 	}
 
+#ifndef IPL_USE_INTPIN_EDGE
     if (!WaitForDevice(INT_PIN_FOLDER)) 
 	{
 		printf("Failed to access INT_PIN_FOLDER, error=%s\n", GetErrnoString());
@@ -194,6 +245,8 @@ uint8_t Ipl_InicDriverOpen(void)
 		printf("Failed to access INT_PIN_FOLDER DIRECTION, error=%s\n", GetErrnoString());
 		return 10U;
 	}
+#endif
+#endif /* IPL_USE_GPIODEV */
 
     return 0U;
 }
@@ -201,10 +254,19 @@ uint8_t Ipl_InicDriverOpen(void)
 
 uint8_t Ipl_InicDriverClose(void)
 {
+#ifndef IPL_USE_I2CDEV
     if (-1 == m_fh) return 1U;
     close(m_fh);
     m_fh = -1;
+#endif
     m_addr = 0xFF;
+#ifdef IPL_USE_INTPIN_EDGE
+    if (-1 != m_intfh)
+    {
+        close(m_intfh);
+        m_intfh = -1;
+    }
+#endif
 
     /* Close Logfile */
     if (tracefile == NULL) return 2U;
@@ -228,6 +290,47 @@ uint8_t Ipl_SetErrBootPin(uint8_t lowHigh)
 }
 
 
+#ifdef IPL_USE_INTPIN_EDGE
+uint8_t Ipl_GetIntPin(void)
+{
+    struct gpio_v2_line_values values;
+    if (-1 == m_intfh) return 2U;
+    values.mask = 1U;
+    values.bits = 0U;
+    if (ioctl(m_intfh, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) < 0) return 2U;
+    return (0U != (values.bits & 1U)) ? 1U : 0U;
+}
+
+
+uint8_t Ipl_WaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs)
+{
+    struct gpio_v2_line_event event;
+    struct pollfd pfd;
+    struct timespec timeout, start, stop;
+    uint8_t pin;
+    int rc;
+    *pElapsedUs = 0U;
+    if (-1 == m_intfh) return 2U;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pfd.fd = m_intfh;
+    pfd.events = POLLIN;
+    /* Discard edges of former commands, then check the level in case INT is already low */
+    while (poll(&pfd, 1, 0) > 0)
+    {
+        if (read(m_intfh, &event, sizeof(event)) != sizeof(event)) return 2U;
+    }
+    pin = Ipl_GetIntPin();
+    if (1U != pin) return pin;
+    timeout.tv_sec  = timeoutUs / 1000000U;
+    timeout.tv_nsec = (timeoutUs % 1000000U) * 1000U;
+    rc = ppoll(&pfd, 1, &timeout, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    *pElapsedUs = (uint32_t)((stop.tv_sec - start.tv_sec) * 1000000 + (stop.tv_nsec - start.tv_nsec) / 1000);
+    if (0 == rc) return 1U;
+    if ((rc < 0) || (read(m_intfh, &event, sizeof(event)) != sizeof(event))) return 2U;
+    return 0U;
+}
+#else
 uint8_t Ipl_GetIntPin(void)
 {
     char buffer[4];
@@ -244,6 +347,7 @@ uint8_t Ipl_GetIntPin(void)
     }
     return 2U;
 }
+#endif
 
 
 uint8_t Ipl_InicWrite(uint8_t lData, uint8_t* pData)
@@ -272,12 +376,85 @@ uint8_t Ipl_InicRead(uint8_t lData, uint8_t* pData)
 }
 
 
-void Ipl_Sleep(uint32_t TimeMs)
+void Ipl_Sleep(uint16_t TimeMs)
 {
     usleep(1000 * TimeMs);
 }
 
 
+#ifdef IPL_USE_SLEEPUS
+void Ipl_SleepUs(uint32_t TimeUs)
+{
+    struct timespec ts;
+    int err;
+    ts.tv_sec  = TimeUs / 1000000U;
+    ts.tv_nsec = (TimeUs % 1000000U) * 1000L;
+    /* Relative sleep on the monotonic clock, resumed with the remaining time if interrupted by a signal */
+    do
+    {
+        err = clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts);
+    } while (EINTR == err);
+}
+#endif
+
+
+#ifdef IPL_USE_TRANSPORT
+/* Registered by Hw_SetupTransport(), IPL calls the functions above through this transport */
+static Ipl_Transport_t m_transport =
+{
+    .Caps            = IPL_TRP_CAP_INTPIN
+#ifdef IPL_USE_INTPIN_EDGE
+                     | IPL_TRP_CAP_INTEDGE
+#endif
+#ifdef IPL_USE_SLEEPUS
+                     | IPL_TRP_CAP_SLEEPUS
+#endif
+                     ,
+    .MaxTelLen       = 0U,
+    .SetResetPin     = Ipl_SetResetPin,
+    .SetErrBootPin   = Ipl_SetErrBootPin,
+    .InicRead        = Ipl_InicRead,
+    .InicWrite       = Ipl_InicWrite,
+    .Sleep           = Ipl_Sleep,
+#ifdef IPL_USE_SLEEPUS
+    .SleepUs         = Ipl_SleepUs,
+#endif
+    .GetIntPin       = Ipl_GetIntPin,
+#ifdef IPL_USE_INTPIN_EDGE
+    .WaitIntEdge     = Ipl_WaitIntEdge,
+#endif
+    .InicDriverOpen  = Ipl_InicDriverOpen,
+    .InicDriverClose = Ipl_InicDriverClose
+};
+
+
+uint8_t Hw_SetupTransport(void)
+{
+#ifdef IPL_USE_I2CDEV
+    /* I2C is done by the i2c-dev transport of IPL, it replaces the I2C functions above */
+    if (IPL_RES_OK != Ipl_I2cDevOpen(&m_transport, I2C_CDEV, HW_INIC_I2C_ADDR))
+    {
+        printf("Failed to open the i2c bus, errno=%d\n", Ipl_I2cDevGetErrno());
+        return IPL_RES_ERR_HW_INIC_COM;
+    }
+#endif
+#ifdef IPL_USE_GPIODEV
+    /* Pins are done by the GPIO transport of IPL, it replaces the sysfs pin functions above */
+#ifdef IPL_USE_INTPIN
+    if (IPL_RES_OK != Ipl_GpioDevOpen(&m_transport, GPIO_CDEV, RESET_LINE, BOOT_LINE, INT_LINE))
+#else
+    if (IPL_RES_OK != Ipl_GpioDevOpen(&m_transport, GPIO_CDEV, RESET_LINE, BOOT_LINE, IPL_GPIODEV_NOLINE))
+#endif
+    {
+        printf("Failed to request the GPIO lines, errno=%d\n", Ipl_GpioDevGetErrno());
+        return IPL_RES_ERR_HW_INIC_PINS;
+    }
+#endif
+    return Ipl_SetTransport(&m_transport);
+}
+#endif
+
+
 void Ipl_Trace(const char *tag, const char* fmt, ...)
 {
     va_list args;
@@ -350,6 +527,7 @@ static bool WriteCharactersToFile( const char *pFileName, const char *pString )
 }
 
 
+#ifndef IPL_USE_INTPIN_EDGE
 static bool ReadFromFile( const char *pFileName, char *pString, uint16_t bufferLen )
 {
     FILE *fh;
@@ -368,8 +546,10 @@ static bool ReadFromFile( const char *pFileName, char *pString, uint16_t bufferL
     }
     return success;
 }
+#endif
 
 
+#ifndef IPL_USE_GPIODEV
 static bool ExistsDevice( const char *pDeviceName )
 {
     struct stat buffer;
@@ -399,6 +579,31 @@ static bool WaitForDevice( const char *pDeviceName )
     }
     return deviceExists;
 }
+#endif
+
+
+#if defined IPL_USE_INTPIN_EDGE && !defined IPL_USE_GPIODEV
+static bool RequestIntLine(void)
+{
+    struct gpio_v2_line_request req;
+    int chip;
+    chip = open(GPIO_CDEV, O_RDONLY);
+    if (chip < 0) return false;
+    memset(&req, 0, sizeof(req));
+    req.offsets[0] = INT_LINE;
+    req.num_lines = 1U;
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    strcpy(req.consumer, "ipl-int");
+    if (ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &req) < 0)
+    {
+        close(chip);
+        return false;
+    }
+    close(chip); /* Line stays requested as long as req.fd is open */
+    m_intfh = req.fd;
+    return true;
+}
+#endif
 
 
 static void SetI2CAddress(uint8_t addr)
@@ -44,6 +44,7 @@
 #include <Windows.h>
 #include "aardvark.h"
 #include "ipl_cfg.h"
+#include "ipl_pb.h"
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -206,6 +207,30 @@ uint8_t Ipl_GetIntPin(void)
 }
 
 
+#ifdef IPL_USE_TRANSPORT
+/* Registered by Hw_SetupTransport(), IPL calls the functions above through this transport */
+static Ipl_Transport_t m_transport =
+{
+    .Caps            = IPL_TRP_CAP_INTPIN,
+    .MaxTelLen       = 0U,
+    .SetResetPin     = Ipl_SetResetPin,
+    .SetErrBootPin   = Ipl_SetErrBootPin,
+    .InicRead        = Ipl_InicRead,
+    .InicWrite       = Ipl_InicWrite,
+    .Sleep           = Ipl_Sleep,
+    .GetIntPin       = Ipl_GetIntPin,
+    .InicDriverOpen  = Ipl_InicDriverOpen,
+    .InicDriverClose = Ipl_InicDriverClose
+};
+
+
+uint8_t Hw_SetupTransport(void)
+{
+    return Ipl_SetTransport(&m_transport);
+}
+#endif
+
+
 void Ipl_Trace(const char *tag, const char* fmt, ...)
 {
     va_list args;
@@ -32,13 +32,32 @@
 #include <unistd.h>
 #include "ipl_cfg.h"
 #include "ipl_pb.h"
+#ifdef IPL_USE_IPZ
+#include "ipl_ipz.h"
+#endif
+#ifdef IPL_USE_IPB
+#include "ipl_ipb.h"
+#endif
+#ifdef IPL_USE_CHUNK_PREFETCH
+#include <pthread.h>
+#endif
+#ifndef _WIN32
+#define EXAMPLE_USE_MMAP /* IPF files are mapped instead of copied */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
 /* EXTERNAL FUNCTIONS                                                                             */
 /*------------------------------------------------------------------------------------------------*/
 
-extern char Hw_GetKey(void);
+extern char    Hw_GetKey(void);
+extern int32_t Xml_LoadIpf(const char* fileName, uint32_t nodeAddr, uint8_t* pData, uint32_t maxLen);
+#ifdef IPL_USE_TRANSPORT
+extern uint8_t Hw_SetupTransport(void);
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -47,6 +66,7 @@ extern char Hw_GetKey(void);
 
 #define IMAGE_MAXLEN    200000U
 #define FILENAME_MAXLEN 1024U
+#define XML_NODE_FIRST  0xFFFFFFFFU /* Xml_LoadIpf() takes the first node containing IpfBytes */
 
 #ifndef STDIN_FILENO
 #define STDIN_FILENO    0
@@ -59,8 +79,28 @@ extern char Hw_GetKey(void);
 
 uint8_t  image[IMAGE_MAXLEN];
 int32_t  imageLen;
+uint8_t* pImage = image;      /* IPF data handed to Ipl_Prog(), either image or the mapped file */
+#ifdef EXAMPLE_USE_MMAP
+uint8_t* pMap   = NULL;
+size_t   mapLen = 0U;
+#endif
 uint8_t  chipid = 0xFF;
 char     ipffile[FILENAME_MAXLEN];
+uint32_t xmlNode  = XML_NODE_FIRST; /* Node address selected with -NODE */
+bool     xmlImage = false;          /* image holds the IpfBytes decoded from an XML file */
+uint32_t ipbOffset = 0U;            /* Offset of the selected member if the file is an IPF bundle */
+#ifdef IPL_USE_STREAMING
+bool     streamIpf = false;   /* IPF data is read forward-only from stdin (-IPF -) */
+uint32_t streamPos = 0U;      /* Number of bytes already read from stdin */
+#endif
+#ifdef IPL_USE_CHUNK_PREFETCH
+uint8_t   prefetch[IPL_DATACHUNK_SIZE];   /* Second buffer, filled in the background */
+char      prefetchFile[FILENAME_MAXLEN];
+uint32_t  prefetchIndex;
+int32_t   prefetchLen;
+bool      prefetchBusy = false;
+pthread_t prefetchThread;
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -68,6 +108,17 @@ char     ipffile[FILENAME_MAXLEN];
 /*------------------------------------------------------------------------------------------------*/
 
 uint32_t load_ipf(char* fileName, uint32_t posData, uint32_t lData, uint8_t* pData);
+int32_t  open_ipf(char* fileName, uint32_t lData);
+#ifdef IPL_USE_IPB
+int32_t  select_ipb(char* fileName, int32_t tl, uint32_t lData);
+#endif
+#ifdef IPL_USE_STREAMING
+uint8_t* stream_ipf(uint32_t sIndex, uint32_t lData);
+#endif
+#ifdef EXAMPLE_USE_MMAP
+int32_t  map_ipf(char* fileName);
+void     unmap_ipf(void);
+#endif
 uint8_t  exec_job(uint8_t job);
 void     print_menu(void);
 void     change_chipid(void);
@@ -83,9 +134,103 @@ void Ipl_Progress(uint8_t percent)
     fflush(stdout);
 }
 
+#ifdef IPL_USE_CHUNK_PREFETCH
+/* Loads the announced chunk while IPL programs the current one. */
+static void* prefetch_run(void* arg)
+{
+    (void) arg;
+    prefetchLen = load_ipf(prefetchFile, ipbOffset + prefetchIndex, IPL_DATACHUNK_SIZE, prefetch);
+    return NULL;
+}
+
+/* Waits until a running prefetch is finished. Returns true if it holds the referred chunk. */
+static bool prefetch_wait(uint32_t sIndex)
+{
+    bool hit = false;
+    if (prefetchBusy)
+    {
+        pthread_join(prefetchThread, NULL);
+        prefetchBusy = false;
+        hit = (sIndex == prefetchIndex) && (prefetchLen > 0) && (0 == strcmp(prefetchFile, ipffile));
+    }
+    return hit;
+}
+
+void Ipl_PrefetchDataChunk(uint32_t sIndex, uint32_t lData)
+{
+#ifdef EXAMPLE_USE_MMAP
+    uintptr_t page;
+#endif
+#ifdef IPL_USE_STREAMING
+    if (streamIpf) /* The stream is read in order anyway */
+    {
+        return;
+    }
+#endif
+    if (xmlImage) /* Already decoded completely */
+    {
+        return;
+    }
+#ifdef EXAMPLE_USE_MMAP
+    if (NULL != pMap)
+    {
+        if ((ipbOffset + sIndex) < mapLen) /* Let the kernel read ahead, nothing is copied */
+        {
+            page = (uintptr_t) &pMap[ipbOffset + sIndex] & ~((uintptr_t) sysconf(_SC_PAGESIZE) - 1U);
+            (void) madvise((void*) page, lData, MADV_WILLNEED);
+        }
+        return;
+    }
+#endif
+    (void) prefetch_wait(sIndex);
+    if ((imageLen <= 0) || (sIndex < (uint32_t) imageLen))
+    {
+        strcpy(prefetchFile, ipffile);
+        prefetchIndex = sIndex;
+        prefetchBusy  = (0 == pthread_create(&prefetchThread, NULL, prefetch_run, NULL));
+    }
+}
+#endif
+
 uint8_t * Ipl_ProvideDataChunk(uint32_t sIndex, uint32_t lData)
 {
-    imageLen = load_ipf(ipffile, sIndex, lData, image);
+#ifdef IPL_USE_STREAMING
+    if (streamIpf)
+    {
+        return stream_ipf(sIndex, lData);
+    }
+#endif
+    if (xmlImage)
+    {
+        return (sIndex < (uint32_t) imageLen) ? &image[sIndex] : NULL;
+    }
+#ifdef EXAMPLE_USE_MMAP
+    if (NULL != pMap)
+    {
+        sIndex += ipbOffset;
+        if (sIndex >= mapLen)
+        {
+            return NULL;
+        }
+        if (((mapLen - sIndex) < lData) && (lData <= IMAGE_MAXLEN))
+        {
+            /* IPL reads lData bytes, so the end of the mapping is copied into a buffer of full chunk size */
+            memset(image, 0, lData);
+            memcpy(image, &pMap[sIndex], mapLen - sIndex);
+            return image;
+        }
+        return &pMap[sIndex];
+    }
+#endif
+#ifdef IPL_USE_CHUNK_PREFETCH
+    if (prefetch_wait(sIndex))
+    {
+        memcpy(image, prefetch, IPL_DATACHUNK_SIZE);
+        imageLen = prefetchLen;
+        return image;
+    }
+#endif
+    imageLen = load_ipf(ipffile, ipbOffset + sIndex, lData, image);
     return image;
 }
 
@@ -136,11 +281,208 @@ uint32_t load_ipf(char* fileName, uint32_t posData, uint32_t lData, uint8_t* pDa
         tl = -1;
         Ipl_Trace("EXAMPLE", "IPF file %s does not exist", fileName);
     }
-    fclose(fp);
+    if (fp != NULL)
+    {
+        fclose(fp);
+    }
+    return tl;
+}
+
+
+#ifdef EXAMPLE_USE_MMAP
+/* Maps an IPF file read-only into memory. Returns the file length, -1 on error. */
+int32_t map_ipf(char* fileName)
+{
+    int32_t     tl = -1;
+    int         fd;
+    struct stat st;
+    void*       p;
+
+    unmap_ipf();
+    fd = open(fileName, O_RDONLY);
+    if (fd >= 0)
+    {
+        if ((0 == fstat(fd, &st)) && (st.st_size > 0) && (st.st_size <= INT32_MAX))
+        {
+            p = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != p)
+            {
+                pMap   = (uint8_t*) p;
+                mapLen = (size_t) st.st_size;
+                tl     = (int32_t) st.st_size;
+                Ipl_Trace("EXAMPLE", "File %s mapped, total %u bytes", fileName, tl);
+            }
+        }
+        close(fd); /* The mapping stays valid */
+    }
     return tl;
 }
 
 
+/* Releases the mapping of the previous IPF file. */
+void unmap_ipf(void)
+{
+    if (NULL != pMap)
+    {
+        munmap(pMap, mapLen);
+        pMap   = NULL;
+        mapLen = 0U;
+    }
+}
+#endif
+
+
+/* Makes an IPF file available for Ipl_Prog(): mapped if possible, otherwise loaded into image.
+   IPZ containers are opened in IPL, the returned length is the one of the original IPF.
+   From UNICENS XML files (*.xml), the IpfBytes of the node xmlNode are decoded into image.
+   Of IPF bundles (IPB), the member for the connected INIC is selected, so the INIC has to be in programming mode. */
+int32_t open_ipf(char* fileName, uint32_t lData)
+{
+    int32_t tl = -1;
+    size_t  ln = strlen(fileName);
+#ifdef IPL_USE_IPZ
+    uint32_t lIpf = 0U;
+    (void) Ipl_IpzClose();
+#endif
+    ipbOffset = 0U;
+    xmlImage = (ln > 4U) && ((0 == strcmp(&fileName[ln - 4U], ".xml")) || (0 == strcmp(&fileName[ln - 4U], ".XML")));
+    if (xmlImage)
+    {
+#ifdef EXAMPLE_USE_MMAP
+        unmap_ipf();
+#endif
+        pImage = image;
+        return Xml_LoadIpf(fileName, xmlNode, image, IMAGE_MAXLEN - IPL_DATACHUNK_SIZE); /* Room for the last chunk */
+    }
+#ifdef EXAMPLE_USE_MMAP
+    tl = map_ipf(fileName);
+    if (tl > 0)
+    {
+        pImage = pMap;
+    }
+    else
+#endif
+    {
+        pImage = image;
+        tl     = load_ipf(fileName, 0, lData, image);
+#ifdef IPL_USE_IPZ
+        if ((tl > 3) && (0 == memcmp(image, "IPZ", 3U)) && (0U != lData))
+        {
+            tl = load_ipf(fileName, 0, 0, image); /* IPL reads the container itself, so it is needed completely */
+        }
+#endif
+    }
+#ifdef IPL_USE_IPB
+    if ((tl > 3) && (0 == memcmp(pImage, "IPB", 3U)))
+    {
+        tl = select_ipb(fileName, tl, lData);
+    }
+#endif
+#ifdef IPL_USE_IPZ
+    if ((tl > 3) && (0 == memcmp(pImage, "IPZ", 3U)))
+    {
+        tl = (IPL_RES_OK == Ipl_IpzOpen(pImage, (uint32_t) tl, &lIpf)) ? (int32_t) lIpf : -1;
+    }
+#endif
+    return tl;
+}
+
+
+#ifdef IPL_USE_IPB
+/* Selects the member of the IPF bundle for the connected INIC, pImage and ipbOffset refer to it afterwards.
+   tl is the bundle length, of which lData bytes are loaded (0: all). Returns the member length, -1 on error. */
+int32_t select_ipb(char* fileName, int32_t tl, uint32_t lData)
+{
+    Ipl_IpbMember_t member;
+    uint8_t         res;
+    uint32_t        lIndex;
+
+    if ((pImage == image) && (0U != lData) && (tl >= 12)) /* Only a part is loaded, the index may be longer */
+    {
+        lIndex = IPB_INDEX_LEN(image[11]); /* At most 255 members */
+        if ((lIndex > lData) && (lIndex <= IMAGE_MAXLEN))
+        {
+            (void) load_ipf(fileName, 0, lIndex, image);
+        }
+    }
+    memset(&member, IPB_ANY, sizeof(member)); /* Connected INIC, newest versions */
+    res = Ipl_IpbSelect(pImage, (uint32_t) tl, &member);
+    printf("\nIpbSelect 0x%02X", res);
+    if (IPL_RES_OK != res)
+    {
+        return -1;
+    }
+    printf(", ChipID 0x%02X, FW V%u.%u.%u, CFGS V%u.%u.%u, %u bytes at offset %u", member.ChipID,
+           member.FwMajorVersion, member.FwMinorVersion, member.FwReleaseVersion,
+           member.CfgsCustMajorVersion, member.CfgsCustMinorVersion, member.CfgsCustReleaseVersion,
+           member.Length, member.Offset);
+    if (member.ChipID != chipid) /* Another INIC of the same family, the jobs need its ChipID */
+    {
+        chipid = member.ChipID;
+        res    = Ipl_EnterProgMode(chipid);
+        printf("\nEnterProgMode 0x%02X", res);
+    }
+    ipbOffset = member.Offset;
+    if (pImage != image)
+    {
+        pImage = &pImage[ipbOffset]; /* Mapped, the member is used in place */
+    }
+    else if (0 > load_ipf(fileName, ipbOffset, (0U != lData) ? lData : member.Length, image))
+    {
+        return -1;
+    }
+    return (int32_t) member.Length;
+}
+#endif
+
+
+#ifdef IPL_USE_STREAMING
+/* Reads the referred chunk from stdin, skipped bytes are discarded. Returns NULL for data already read. */
+uint8_t* stream_ipf(uint32_t sIndex, uint32_t lData)
+{
+    uint32_t want;
+    uint32_t got = 0U;
+    ssize_t  rd  = 1;
+
+    if (sIndex < streamPos)
+    {
+        Ipl_Trace("EXAMPLE", "Stream pos %u already passed, now at %u", sIndex, streamPos);
+        return NULL;
+    }
+    while ((streamPos < sIndex) && (rd > 0)) /* Skip data IPL does not need */
+    {
+        want = sIndex - streamPos;
+        if (want > lData)
+        {
+            want = lData;
+        }
+        rd = read(STDIN_FILENO, image, want);
+        if (rd > 0)
+        {
+            streamPos += (uint32_t) rd;
+        }
+    }
+    while ((got < lData) && (rd > 0)) /* Pipes and sockets may return less than requested */
+    {
+        rd = read(STDIN_FILENO, &image[got], lData - got);
+        if (rd > 0)
+        {
+            got += (uint32_t) rd;
+        }
+    }
+    if (rd < 0)
+    {
+        Ipl_Trace("EXAMPLE", "Stream read error at pos %u", streamPos);
+        return NULL;
+    }
+    memset(&image[got], 0, lData - got); /* End of stream */
+    streamPos += got;
+    Ipl_Trace("EXAMPLE", "Stream pos %u, len %u bytes read", sIndex, got);
+    return image;
+}
+#endif
+
+
 /* Prints the main menu of the example application (interactive mode). */
 void print_menu(void)
 {
@@ -262,10 +604,11 @@ void change_chipid(void)
 uint8_t exec_job(uint8_t job)
 {
     uint8_t res;
+    Ipl_TimingProfile_t tim;
     switch (job)
     {
         case IPL_JOB_READ_CONFIGSTRING_VER:
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("ReadConfigStringVersion 0x%02X ", res);
             fflush(stdout);
             if (IPL_RES_OK == res)
@@ -281,59 +624,59 @@ uint8_t exec_job(uint8_t job)
         case IPL_JOB_PROG_FIRMWARE:
             printf("ProgramFirmware [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_CONFIG:
             printf("ProgramConfiguration [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_PATCHSTRING:
             printf("ProgramPatchString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_TEST_CONFIG:
             printf("ProgramTestConfiguration [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_TEST_PATCHSTRING:
             printf("ProgramTestPatchString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_CONFIGSTRING:
             printf("ProgramConfigString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_TEST_CONFIGSTRING:
             printf("ProgramTestConfigString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_IDENTSTRING:
             printf("ProgramIdentString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_PROG_TEST_IDENTSTRING:
             printf("ProgramTestIdentString [  0%%]");
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
         case IPL_JOB_READ_FIRMWARE_VER:
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("ReadFirmwareVersion 0x%02X ", res);
             fflush(stdout);
             if (IPL_RES_OK == res)
@@ -347,19 +690,33 @@ uint8_t exec_job(uint8_t job)
             }
             break;
         case IPL_JOB_CHK_UPDATE_CONFIGSTRING:
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("CheckUpdateConfigString 0x%02X \n", res);
             fflush(stdout);
             break;
         case IPL_JOB_CHK_UPDATE_FIRMWARE:
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("CheckUpdateFirmware 0x%02X \n", res);
             fflush(stdout);
             break;
+        case IPL_JOB_CALIBRATE_TIMING:
+            res = Ipl_Prog(job, imageLen, pImage);
+            printf("CalibrateTiming 0x%02X ", res);
+            if ((IPL_RES_OK == res) && (IPL_RES_OK == Ipl_GetTimingProfile(chipid, &tim)))
+            {
+                printf("- Resp: %u us - Program: %u us - EraseProgMem: %u us - EraseInfoMem: %u us - Bootup: %u us\n",
+                       tim.RespWaitTime, tim.ProgramWaitTime, tim.EraseProgMemWaitTime, tim.EraseInfoMemWaitTime, tim.BootupTime);
+            }
+            else
+            {
+                printf("\n");
+            }
+            fflush(stdout);
+            break;
         default:
             printf("Job [0x%02X] [  0%%]", job);
             fflush(stdout);
-            res = Ipl_Prog(job, imageLen, image);
+            res = Ipl_Prog(job, imageLen, pImage);
             printf("\b\b\b\b\b\b0x%02X     \n", res);
             break;
     }
@@ -383,7 +740,15 @@ int main(int argc, char** argv)
     {
         image[i] = 0x00;
     }
-    if ( argc == 5 || argc == 7 ) /* Parse arguments */
+#ifdef IPL_USE_TRANSPORT
+    res = Hw_SetupTransport();
+    if (IPL_RES_OK != res)
+    {
+        printf("SetupTransport 0x%02X\n", res);
+        return 1;
+    }
+#endif
+    if ( argc == 5 || argc == 7 || argc == 9 ) /* Parse arguments */
     {
         if ( 0 == strcmp(argv[1], "-INIC") )
         {
@@ -401,7 +766,7 @@ int main(int argc, char** argv)
             else err_syntax = true;
         }
         else err_syntax = true;
-        if ( argc == 7U )
+        if ( argc >= 7U )
         {
             if ( 0 == strcmp(argv[5], "-IPF") )
             {
@@ -409,6 +774,21 @@ int main(int argc, char** argv)
             }
             else err_syntax = true;
         }
+        if ( argc == 9U )
+        {
+            if ( 0 == strcmp(argv[7], "-NODE") )
+            {
+                xmlNode = (uint32_t) strtoul(argv[8], NULL, 0);
+            }
+#ifdef IPL_USE_STREAMING
+            else if ( ( 0 == strcmp(argv[6], "-") ) && ( 0 == strcmp(argv[7], "-LEN") ) )
+            {
+                streamIpf = true;
+                imageLen  = (int32_t) strtoul(argv[8], NULL, 0);
+            }
+#endif
+            else err_syntax = true;
+        }
         if ( 0 == strcmp(argv[3], "-JOB") )
         {
             if      ( 0 == strcmp(argv[4], "READ_FIRMWARE_VER" ) )         jobid = IPL_JOB_READ_FIRMWARE_VER;
@@ -424,6 +804,7 @@ int main(int argc, char** argv)
             else if ( 0 == strcmp(argv[4], "PROG_TEST_IDENTSTRING" ) )     jobid = IPL_JOB_PROG_TEST_IDENTSTRING;
             else if ( 0 == strcmp(argv[4], "CHK_UPDATE_CONFIGSTRING" ) )   jobid = IPL_JOB_CHK_UPDATE_CONFIGSTRING;
             else if ( 0 == strcmp(argv[4], "CHK_UPDATE_FIRMWARE" ) )       jobid = IPL_JOB_CHK_UPDATE_FIRMWARE;
+            else if ( 0 == strcmp(argv[4], "CALIBRATE_TIMING" ) )          jobid = IPL_JOB_CALIBRATE_TIMING;
 #ifdef IPL_CHK_IPF_JOBS
             else if ( 0 == strcmp(argv[4], "CHK_IPF_CONFIGSTRING" ) )      jobid = IPL_JOB_CHK_IPF_CONFIGSTRING;
             else if ( 0 == strcmp(argv[4], "CHK_IPF_IDENTSTRING" ) )       jobid = IPL_JOB_CHK_IPF_IDENTSTRING;
@@ -446,9 +827,17 @@ int main(int argc, char** argv)
     {
         res = Ipl_EnterProgMode(chipid);
         printf("\n\nEnterProgMode 0x%02X", res);
-        if (argc == 7)
+#ifdef IPL_USE_STREAMING
+        if (streamIpf)
         {
-             imageLen = load_ipf(ipffile, 0, 0, image);
+             pImage = image; /* Only identifies the IPF, the data comes from stream_ipf() */
+             printf("\nStreaming %d bytes from stdin\n", imageLen);
+        }
+        else
+#endif
+        if (argc >= 7)
+        {
+             imageLen = open_ipf(ipffile, 0);
              if (imageLen > 0)
              {
                  printf("\nFile %s loaded, total %u bytes\n", ipffile, imageLen);
@@ -476,7 +865,20 @@ int main(int argc, char** argv)
         printf("\r\n");
         printf("  [-IPF Filename]\r\n");
         printf("    data file used for programming (IPF Format)\r\n");
+        printf("    UNICENS XML files (*.xml) are decoded from their IpfBytes\r\n");
+#ifdef IPL_USE_IPB
+        printf("    of IPF bundles (*.ipb) the member for the connected INIC is used,\r\n");
+        printf("    -INIC then only selects the INIC family (e.g. OS81210 for OS81210...OS81216)\r\n");
+#endif
         printf("\r\n");
+        printf("  [-IPF Filename.xml -NODE Address]\r\n");
+        printf("    selects the node of a multi-node XML file (default: first node)\r\n");
+        printf("\r\n");
+#ifdef IPL_USE_STREAMING
+        printf("  [-IPF - -LEN Bytes]\r\n");
+        printf("    IPF data streamed from stdin (pipe, socket), length in bytes\r\n");
+        printf("\r\n");
+#endif
         printf("  Examples:\r\n");
         printf("    %s -INIC OS81118 -JOB READ_FIRMWARE_VER\r\n", argv[0]);
         printf("    %s -INIC OS81210 -JOB READ_CONFIGSTRING_VER -IPF myFile.ipf\r\n", argv[0]);
@@ -491,7 +893,14 @@ int main(int argc, char** argv)
         printf("    %s -INIC OS81214 -JOB PROG_TEST_IDENTSTRING -IPF myFile.ipf\r\n", argv[0]);
         printf("    %s -INIC OS81214 -JOB CHK_UPDATE_CONFIG -IPF myFile.ipf\r\n", argv[0]);
         printf("    %s -INIC OS81118 -JOB CHK_UPDATE_FIRMWARE -IPF myFile.ipf\r\n", argv[0]);
-        printf("    %s -INIC OS81118 -JOB CHK_IPF_CONFIGSTRING -IPF myFile.ipf\r\n\n", argv[0]);
+        printf("    %s -INIC OS81118 -JOB CHK_IPF_CONFIGSTRING -IPF myFile.ipf\r\n", argv[0]);
+        printf("    %s -INIC OS81210 -JOB PROG_CONFIG -IPF OS81210_Raspi_I2C.xml -NODE 0x140\r\n\n", argv[0]);
+#ifdef IPL_USE_IPB
+        printf("    %s -INIC OS81210 -JOB PROG_FIRMWARE -IPF allBoards.ipb\r\n\n", argv[0]);
+#endif
+#ifdef IPL_USE_STREAMING
+        printf("    cat myFile.ipf | %s -INIC OS81118 -JOB PROG_FIRMWARE -IPF - -LEN 131072\r\n\n", argv[0]);
+#endif
         return -1;
     }
     /* Interactive mode */
@@ -517,7 +926,7 @@ int main(int argc, char** argv)
                 {
                     ipffile[--res] = '\0';
                 }
-                imageLen = load_ipf(ipffile, 0, IPL_DATACHUNK_SIZE, image);
+                imageLen = open_ipf(ipffile, IPL_DATACHUNK_SIZE);
                 if (imageLen > 0)
                 {
                     printf("File %s loaded, total %u bytes\n", ipffile, imageLen);
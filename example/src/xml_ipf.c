@@ -0,0 +1,303 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   xml_ipf.c
+ *  \brief  Loads the IPF data embedded in UNICENS System Designer XML files
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ *
+ *  The IPF data of a node is stored as hex text in /Unicens/Node/Configuration/Contents with the
+ *  attribute Name="IpfBytes" (see unicens.xsd). The bytes are separated by whitespace, the IPF
+ *  fields additionally by '-'. The text is decoded with a lookup table, three characters
+ *  ("XX ") per step in the common case.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define XML_NODE_FIRST  0xFFFFFFFFU /* Selects the first node containing IpfBytes */
+
+#define HEX_SEP         0x10U       /* Whitespace or '-' between bytes */
+#define HEX_BAD         0xFFU       /* Any other character */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+int32_t Xml_LoadIpf(const char* fileName, uint32_t nodeAddr, uint8_t* pData, uint32_t maxLen);
+static int32_t     Xml_DecodeHex(const char* pText, const char* pEnd, uint8_t* pData, uint32_t maxLen);
+static const char* xml_find(const char* p, const char* pEnd, const char* pTag);
+static const char* xml_attr(const char* pTag, const char* pEnd, const char* pName);
+static void        hex_init(void);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint8_t hexTable[256];
+static bool    hexReady = false;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/* Loads the IpfBytes of the node with the referred address (XML_NODE_FIRST: first node having them).
+   Returns the IPF length, -1 on error. */
+int32_t Xml_LoadIpf(const char* fileName, uint32_t nodeAddr, uint8_t* pData, uint32_t maxLen)
+{
+    int32_t     tl   = -1;
+    long        lXml = -1;
+    char*       pXml = NULL;
+    const char* pEnd;
+    const char* pNode;
+    const char* pNodeEnd;
+    const char* pAttr;
+    const char* p;
+    FILE*       fp;
+
+    fp = fopen(fileName, "rb");
+    if (fp != NULL)
+    {
+        fseek(fp, 0, SEEK_END);
+        lXml = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        if (lXml > 0)
+        {
+            pXml = malloc((size_t) lXml);
+        }
+        if ((pXml != NULL) && (1U != fread(pXml, (size_t) lXml, 1U, fp)))
+        {
+            free(pXml);
+            pXml = NULL;
+        }
+        fclose(fp);
+    }
+    if (pXml == NULL)
+    {
+        Ipl_Trace("EXAMPLE", "XML file %s could not be read", fileName);
+        return -1;
+    }
+    pEnd  = pXml + lXml;
+    pNode = xml_find(pXml, pEnd, "<Node");
+    while ((pNode != NULL) && (tl < 0))
+    {
+        pNodeEnd = xml_find(pNode, pEnd, "</Node>");
+        if (pNodeEnd == NULL)
+        {
+            pNodeEnd = pEnd;
+        }
+        pAttr = xml_attr(pNode, pNodeEnd, "Address");
+        if ((nodeAddr == XML_NODE_FIRST) || ((pAttr != NULL) && (nodeAddr == (uint32_t) strtoul(pAttr, NULL, 0))))
+        {
+            p = xml_find(pNode, pNodeEnd, "<Contents");
+            while ((p != NULL) && (tl < 0))
+            {
+                pAttr = xml_attr(p, pNodeEnd, "Name");
+                if ((pAttr != NULL) && (0 == strncmp(pAttr, "IpfBytes\"", 9U)))
+                {
+                    p = memchr(p, '>', (size_t) (pNodeEnd - p));
+                    if (p != NULL)
+                    {
+                        pAttr = xml_find(p, pNodeEnd, "</Contents>");
+                        p++;
+                        if ((pAttr != NULL) && ((pAttr - p) > 12) && (0 == strncmp(p, "<![CDATA[", 9U)))
+                        {
+                            p += 9;    /* Text may also be given as CDATA section */
+                            pAttr -= 3;
+                        }
+                        tl = (pAttr != NULL) ? Xml_DecodeHex(p, pAttr, pData, maxLen) : -1;
+                        if (tl < 0)
+                        {
+                            break; /* Node found, but IpfBytes invalid */
+                        }
+                    }
+                }
+                p = (p != NULL) ? xml_find(p + 1, pNodeEnd, "<Contents") : NULL;
+            }
+            if ((tl < 0) && (nodeAddr != XML_NODE_FIRST))
+            {
+                break;
+            }
+        }
+        pNode = xml_find(pNodeEnd, pEnd, "<Node");
+    }
+    if (tl > 0)
+    {
+        Ipl_Trace("EXAMPLE", "XML file %s: IpfBytes decoded, %u bytes", fileName, tl);
+    }
+    else
+    {
+        Ipl_Trace("EXAMPLE", "XML file %s: no valid IpfBytes for node 0x%X", fileName, nodeAddr);
+    }
+    free(pXml);
+    return tl;
+}
+
+
+/* Decodes hex text with '-' and whitespace separators. Returns the number of bytes, -1 on error. */
+static int32_t Xml_DecodeHex(const char* pText, const char* pEnd, uint8_t* pData, uint32_t maxLen)
+{
+    const uint8_t* p = (const uint8_t*) pText;
+    const uint8_t* e = (const uint8_t*) pEnd;
+    uint32_t n = 0U;
+    uint8_t  hi, lo;
+
+    hex_init();
+    while (p < e)
+    {
+        hi = hexTable[p[0]];
+        if (hi == HEX_SEP)
+        {
+            p++;
+            continue;
+        }
+        if ((hi > 0x0FU) || ((e - p) < 2) || (n >= maxLen))
+        {
+            return -1;
+        }
+        lo = hexTable[p[1]];
+        if (lo > 0x0FU)
+        {
+            return -1;
+        }
+        pData[n++] = (uint8_t) ((hi << 4) | lo);
+        if (((e - p) >= 3) && (hexTable[p[2]] == HEX_SEP))
+        {
+            p += 3; /* "XX " */
+        }
+        else
+        {
+            p += 2;
+        }
+    }
+    return (int32_t) n;
+}
+
+
+/* Returns the next occurrence of the referred tag, comments and CDATA sections are skipped. */
+static const char* xml_find(const char* p, const char* pEnd, const char* pTag)
+{
+    size_t      len = strlen(pTag);
+    const char* q;
+    char        c;
+    while (p != NULL)
+    {
+        p = memchr(p, '<', (size_t) (pEnd - p));
+        if ((p == NULL) || ((size_t) (pEnd - p) < len))
+        {
+            return NULL;
+        }
+        if (((pEnd - p) >= 4) && (0 == strncmp(p, "<!--", 4U)))
+        {
+            q = p + 4;
+            while ((q != NULL) && ((pEnd - q) >= 3) && (0 != strncmp(q, "-->", 3U)))
+            {
+                q = memchr(q + 1, '-', (size_t) (pEnd - q - 1));
+            }
+            p = ((q != NULL) && ((pEnd - q) >= 3)) ? (q + 3) : NULL;
+        }
+        else if (((pEnd - p) >= 9) && (0 == strncmp(p, "<![CDATA[", 9U)) && (pTag[1] != '!'))
+        {
+            q = p + 9;
+            while ((q != NULL) && ((pEnd - q) >= 3) && (0 != strncmp(q, "]]>", 3U)))
+            {
+                q = memchr(q + 1, ']', (size_t) (pEnd - q - 1));
+            }
+            p = ((q != NULL) && ((pEnd - q) >= 3)) ? (q + 3) : NULL;
+        }
+        else if (0 == strncmp(p, pTag, len))
+        {
+            c = ((size_t) (pEnd - p) > len) ? p[len] : '>';
+            if ((pTag[len - 1U] == '>') || (c == ' ') || (c == '>') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '/'))
+            {
+                return p; /* Whole tag name, e.g. <Node but not <NodeList */
+            }
+            p++;
+        }
+        else
+        {
+            p++;
+        }
+    }
+    return NULL;
+}
+
+
+/* Returns the value of the referred attribute (first character behind the quote) of the tag at pTag. */
+static const char* xml_attr(const char* pTag, const char* pEnd, const char* pName)
+{
+    size_t      len = strlen(pName);
+    const char* pGt = memchr(pTag, '>', (size_t) (pEnd - pTag));
+    const char* p;
+    if (pGt != NULL)
+    {
+        for (p = pTag + 1; (size_t) (pGt - p) > (len + 2U); p++)
+        {
+            if (((p[-1] == ' ') || (p[-1] == '\t') || (p[-1] == '\r') || (p[-1] == '\n')) &&
+                (0 == strncmp(p, pName, len)) && (p[len] == '=') && (p[len + 1U] == '"'))
+            {
+                return p + len + 2U;
+            }
+        }
+    }
+    return NULL;
+}
+
+
+/* Builds the lookup table once: hex digits to their value, separators to HEX_SEP. */
+static void hex_init(void)
+{
+    uint32_t i;
+    if (!hexReady)
+    {
+        for (i = 0U; i < 256U; i++)
+        {
+            hexTable[i] = HEX_BAD;
+        }
+        for (i = 0U; i < 10U; i++)
+        {
+            hexTable['0' + i] = (uint8_t) i;
+        }
+        for (i = 0U; i < 6U; i++)
+        {
+            hexTable['A' + i] = (uint8_t) (10U + i);
+            hexTable['a' + i] = (uint8_t) (10U + i);
+        }
+        hexTable[' ']  = HEX_SEP;
+        hexTable['\t'] = HEX_SEP;
+        hexTable['\r'] = HEX_SEP;
+        hexTable['\n'] = HEX_SEP;
+        hexTable['-']  = HEX_SEP;
+        hexReady = true;
+    }
+}
@@ -66,6 +66,155 @@
 
 // #define IPL_USE_INTPIN
 
+/*! Enables waiting for the falling edge of INIC's INT_ pin instead of polling the pin level.
+    Only possible if ::IPL_USE_INTPIN is defined.
+    If the macro is defined, the additional callback function ::Ipl_WaitIntEdge() needs to be implemented.
+    The function blocks until INIC's INT_ pin is LOW or the referred timeout (in us) expired. This avoids
+    the polling granularity of ::Ipl_GetIntPin().
+    If the macro is not defined, IPL polls ::Ipl_GetIntPin() every 100 us (every millisecond without
+    ::IPL_USE_SLEEPUS).
+*/
+
+// #define IPL_USE_INTPIN_EDGE
+
+/*!@}*/
+
+
+/*! \defgroup completion_polling Completion Polling
+ *  \ingroup  conf
+ *  Please select, if IPL should poll INIC for the completion of a programming command instead of
+ *  sleeping the worst case time. If the macro is not defined, IPL will use sleep with reasonable timings.
+ */
+/*!@{*/
+
+/*! Enables completion polling for program memory write commands.
+    If the macro is defined, IPL retries reading INIC's response with a growing backoff (0.1, 0.2, 0.4, ... ms)
+    until INIC acknowledges the read with a completion code. The overall wait time is limited by the
+    worst case time that is used without polling. Failing reads during polling are expected and are not
+    reported as error. The response times of all commands are collected per command and traced when
+    ::Ipl_LeaveProgMode() is called. Times after a fixed delay are the delay.
+    If the macro is not defined, IPL sleeps the worst case time before reading the response.
+*/
+
+// #define IPL_USE_COMPLETION_POLLING
+
+/*! Enables early completion of erase commands.
+    If the macro is defined, IPL checks every 10 ms if INIC has completed an erase command and continues
+    as soon as it has. If ::IPL_USE_INTPIN is defined, the INT_ pin is checked, otherwise INIC's response
+    is read. The progress of the erase is indicated by ::Ipl_Progress() relative to the worst case time.
+    If the macro is not defined, IPL waits the worst case time after an erase command.
+*/
+
+// #define IPL_USE_ERASE_POLLING
+
+/*!@}*/
+
+
+/*! \defgroup startup_probing Startup Probing
+ *  \ingroup  conf
+ *  Please select, if IPL should probe INIC's bootloader after reset instead of waiting the worst case
+ *  boot-up time.
+ */
+/*!@{*/
+
+/*! Enables probing of the bootloader when INIC is started in programming mode.
+    If the macro is defined, IPL reads one byte from INIC every 0.5 ms after RESET_ has been released,
+    until INIC acknowledges its I2C address. The overall time is limited by the worst case time that
+    is used without probing. Failing reads during probing are expected and are not reported as error.
+    Starting INIC in normal mode (::Ipl_LeaveProgMode()) always waits the worst case time, since the
+    firmware is not to be disturbed by IPL.
+    If the macro is not defined, IPL waits the worst case time after every reset.
+*/
+
+// #define IPL_USE_STARTUP_PROBING
+
+/*!@}*/
+
+
+/*! \defgroup sleep_us Microsecond Sleep Callback Function
+ *  \ingroup  conf
+ *  By default IPL sleeps via ::Ipl_Sleep() in steps of milliseconds. If your platform can sleep
+ *  shorter times, the callback ::Ipl_SleepUs() can be enabled.
+ */
+/*!@{*/
+
+/*! Enables the callback ::Ipl_SleepUs() for waits in microseconds.
+    If the macro is defined, all waits of IPL are done by ::Ipl_SleepUs() and ::Ipl_Sleep() is not used.
+    If the macro is not defined, the waits are rounded up to full milliseconds and done by ::Ipl_Sleep().
+*/
+
+// #define IPL_USE_SLEEPUS
+
+/*!@}*/
+
+
+/*! \defgroup inic_transfer Combined Transfer Callback Function
+ *  \ingroup  conf
+ *  If your INIC driver can send a telegram and read the response in one transfer (e.g. with a
+ *  repeated start condition), the callback ::Ipl_InicTransfer() can be enabled.
+ */
+/*!@{*/
+
+/*! Enables the callback ::Ipl_InicTransfer() for sending a command and reading its response.
+    If the macro is defined, ::Ipl_InicTransfer() is used for all commands that only need a delay
+    before the response is read. Commands that wait for the INT_ pin or are polled for completion
+    still use ::Ipl_InicWrite() and ::Ipl_InicRead().
+    If the macro is not defined, only ::Ipl_InicWrite() and ::Ipl_InicRead() are used.
+*/
+
+// #define IPL_USE_INICTRANSFER
+
+/*!@}*/
+
+
+/*! \defgroup inic_batch Batch Transfer Callback Function
+ *  \ingroup  conf
+ *  If your INIC driver can execute several telegrams in one host call (e.g. one multi-message I2C
+ *  transfer), the callback ::Ipl_InicTransferBatch() can be enabled.
+ */
+/*!@{*/
+
+/*! Enables the callback ::Ipl_InicTransferBatch() for executing several telegrams at once.
+    If the macro is defined, the program memory write telegrams are queued and executed in batches of up
+    to 8 telegrams. The callback waits for each response with the wait time of the timing profile
+    (::Ipl_SetTimingProfile()), with ::IPL_USE_COMPLETION_POLLING program memory writes are polled
+    instead. Telegrams that need the INT_ pin (::IPL_USE_INTPIN) are executed on their own.
+    If the macro is not defined, every telegram is executed on its own.
+*/
+
+// #define IPL_USE_INICBATCH
+
+/*!@}*/
+
+
+/*! \defgroup transport Transport Registration
+ *  \ingroup  conf
+ *  If one application should drive several hardware backends, the hardware callbacks can be
+ *  replaced by a transport that is registered at runtime with ::Ipl_SetTransport().
+ */
+/*!@{*/
+
+/*! Enables the registration of a transport (::Ipl_Transport_t) for all hardware accesses.
+    If the macro is defined, IPL does not call the hardware callback functions (::Ipl_InicWrite(),
+    ::Ipl_SetResetPin(), ...), but the functions of the registered transport. The options above
+    enable the respective code in IPL, the capabilities of the transport decide at runtime whether it is used.
+    If the macro is not defined, the hardware callback functions are linked directly.
+*/
+
+// #define IPL_USE_TRANSPORT
+
+/*! Enables the Linux i2c-dev transport functions (::Ipl_I2cDevOpen()) shipped with IPL.
+    Requires ::IPL_USE_TRANSPORT. Only define the macro when building for Linux.
+*/
+
+// #define IPL_USE_I2CDEV
+
+/*! Enables the Linux GPIO character device transport functions (::Ipl_GpioDevOpen()) shipped with IPL.
+    Requires ::IPL_USE_TRANSPORT. Only define the macro when building for Linux.
+*/
+
+// #define IPL_USE_GPIODEV
+
 /*!@}*/
 
 
@@ -97,6 +246,40 @@
 
 /*!@}*/
 
+/*! \defgroup host_crc Host CRC Calculation
+ *  \ingroup  conf
+ *  IPL can calculate the CRC of the firmware on the host. The IPF strings carry a CRC-16/KERMIT
+ *  (polynomial 0x1021 reflected, start value 0) in their last two bytes, so the CRC over a whole
+ *  string is 0. CMD_GETCRC reports the CRC over the data written since CMD_CLEARCRC.
+ *  The legacy INICs (OS81050, OS81060, OS81082, OS81092, OS81110) are deliberately not covered: their
+ *  bootloader reports no firmware CRC and their drivers program fixed memory ranges, so both options
+ *  have no effect there.
+ */
+/*!@{*/
+
+/*! Enables the host CRC calculation. The CRCs of the FW string are calculated once and kept with the
+    IPF string index. If the FW string does not end with its CRC, programming fails with
+    ::IPL_RES_ERR_WRONG_CRC before the program memory is erased. At the end of every program memory page
+    the CRC of the INIC is compared with the host calculated CRC; if it differs twice, programming stops
+    with ::IPL_RES_ERR_WRONG_CRC. Used by the OS81118/OS81119 driver only. Cannot be used with
+    ::IPL_USE_STREAMING, the FW string is read once more for the calculation.
+    If the macro is not defined, the CRC is only checked after the last write.
+*/
+
+// #define IPL_USE_HOSTCRC
+
+/*! Enables the comparison of the firmware in the INIC before it is erased. The firmware CRC reported by
+    the bootloader is compared with the host calculated CRC first. Only if it matches, the program memory
+    is read back and compared byte by byte with the FW string, stopping at the first block that differs.
+    If the firmware is identical, erasing and programming is skipped. Requires ::IPL_USE_HOSTCRC, used by
+    the OS81118/OS81119 driver only. Cannot be used with ::IPL_USE_STREAMING.
+    If the macro is not defined, the firmware is always programmed.
+*/
+
+// #define IPL_USE_SKIP_IDENTICAL_FW
+
+/*!@}*/
+
 /*! \defgroup chunk_handling Data Chunk Handling
  *  \ingroup  conf
  *  Adds a callback function to provide single data chunks instead of the complete IPF data.
@@ -112,10 +295,76 @@
  *  ::Ipl_ProvideDataChunk() is used for the application to provide
  *  the respective data chunk.
  *  If the value is 0, the complete IPF data is referred in the ::Ipl_Prog() call (no callback is used).
+ *  The chunk buffer is global, so with chunks IPL must not be called from more than one thread.
  */
 
 #define IPL_DATACHUNK_SIZE 2048
 
+/*! Enables the callback ::Ipl_PrefetchDataChunk(), which announces the data chunk IPL will request next.
+    The application can load that chunk in the background while the current chunk is programmed,
+    so ::Ipl_ProvideDataChunk() returns without waiting for the storage. Requires ::IPL_DATACHUNK_SIZE > 0.
+    If the macro is not defined, every chunk is loaded when it is requested.
+*/
+
+// #define IPL_USE_CHUNK_PREFETCH
+
+/*! \brief Number of data chunks (2...16) kept in an LRU cache inside IPL. Requires ::IPL_DATACHUNK_SIZE > 0.
+ *
+ *  Each slot holds one chunk of ::IPL_DATACHUNK_SIZE bytes. Chunks read again, e.g. the string
+ *  headers and the meta data while the payload is programmed, are then taken from the cache
+ *  instead of calling ::Ipl_ProvideDataChunk() again. The hits and misses of a programming session
+ *  are returned by ::Ipl_GetChunkCacheStats().
+ *  If the macro is not defined, only the chunk in use is kept.
+ */
+
+// #define IPL_CHUNKCACHE_SLOTS 4
+
+/*! Enables the forward-only streaming of the IPF data, e.g. from stdin, a pipe or a socket.
+    IPL then requests the chunks from ::Ipl_ProvideDataChunk() with ascending offsets only, chunks
+    that are skipped are not requested at all. The string headers are located while the data is read
+    and data read again (string headers, meta data) is taken from the chunk cache. A chunk that was
+    already provided and has been evicted from the cache is not requested again, the job then fails with
+    ::IPL_RES_ERR_INVALID_DATACHUNK. The meta data and the headers of the programmed strings have to
+    precede the programmed data in the stream. Requires ::IPL_CHUNKCACHE_SLOTS.
+    If the macro is not defined, IPL may request any chunk at any time.
+*/
+
+// #define IPL_USE_STREAMING
+
+/*! Enables compressed IPF containers (IPZ, see ::Ipl_IpzOpen()). While a container is open, IPL
+    decompresses each data chunk from it directly into its chunk buffer, ::Ipl_ProvideDataChunk()
+    is not called. Requires ::IPL_DATACHUNK_SIZE > 0, the container needs to be created with the same block size.
+    If the macro is not defined, the IPF data is always provided uncompressed.
+*/
+
+// #define IPL_USE_IPZ
+
+/*! Enables multi-chip IPF bundles (IPB, see ::Ipl_IpbSelect()). One bundle holds the IPF files of
+    several INICs and versions, after ::Ipl_EnterProgMode() the member fitting to the connected INIC
+    is looked up by its ChipID. If the macro is not defined, the application selects the IPF file.
+*/
+
+// #define IPL_USE_IPB
+
+/*!@}*/
+
+/*! \defgroup tel_size Telegram Size
+ *  \ingroup  conf
+ *  The number of data bytes per write telegram is taken from the IPF meta data
+ *  (BmMaxDataLength), limited by the size of the telegram buffer.
+ */
+
+/*!@{*/
+
+/*! \brief Largest number of data bytes in one telegram. The telegram buffers are 4 bytes larger.
+ *
+ *  Range is 32...251, default is 32 (all bootloaders released so far).
+ *  If the IPF announces a larger BmMaxDataLength, a larger value lets IPL write
+ *  the memories with fewer telegrams. Smaller meta values are always used as they are.
+ */
+
+#define IPL_MAX_DATALENGTH 32U
+
 /*!@}*/
 
 /*! \defgroup trace_tags Trace Tags
@@ -41,7 +41,10 @@
 #define STRINGTYPE_IS                   0x04U
 #define STRINGTYPE_PS                   0x05U
 #define STRINGTYPE_META                 0x07U
+#define STRINGTYPE_MAX                  STRINGTYPE_META
 #define STRING_MIN_LEN                  32U
+#define STRING_MAX_PAGECRCS             8U
+#define STRING_MAX_INDEX                16U
 
 #define METAID_CHIPID                   0x00000100U
 #define METAID_CHIPPRGMEMSIZE           0x00000101U
@@ -154,15 +157,75 @@ typedef struct Ipl_MetaData_
 } Ipl_MetaData_t;
 
 
-/* Data derived from IPF file */
+/* String header found in IPF file */
+typedef struct Ipl_IpfString_
+{
+    uint8_t        Type;                /* StringType as referred in the string header */
+    uint32_t       Offset;              /* Offset of the string header */
+    uint32_t       Size;                /* Size of data as referred in the string header */
+    uint32_t       ProgAddr;            /* Address as referred in the string header */
+} Ipl_IpfString_t;
+
+
+#ifdef IPL_USE_HOSTCRC
+/* CRCs of one string calculated on the host with Ipl_CalcCrc() */
+typedef struct Ipl_IpfCrc_
+{
+    uint8_t        Valid;               /* IPL_HIGH if the CRCs are calculated for StringType */
+    uint8_t        StringType;          /* Type of the string */
+    uint16_t       Crc;                 /* CRC of the whole string, 0 if the string ends with its CRC */
+    uint16_t       BodyCrc;             /* CRC of the string without its last two bytes */
+    uint8_t        NumOfPages;          /* Number of valid PageCrc values */
+    uint16_t       PageCrc[STRING_MAX_PAGECRCS]; /* CRC at the end of each program memory page (FW only) */
+} Ipl_IpfCrc_t;
+#endif
+
+
+/* Index of all strings in IPF file, built in one pass (with streaming up to the string looked for) */
+typedef struct Ipl_IpfIndex_
+{
+    uint8_t*        pData;              /* IPF data the index was built for */
+    uint32_t        lData;              /* Length of the IPF data the index was built for */
+    uint32_t        Key;                /* Hash of the IPF header and the first string header, 0 with streaming */
+    uint8_t         Valid;              /* IPL_HIGH if the index is built for pData */
+    uint8_t         Complete;           /* IPL_HIGH if all string headers are recorded */
+    uint8_t         ChipID;             /* ChipID from the IPF header */
+    uint32_t        Next;               /* Offset of the first string header not recorded yet */
+    uint8_t         NumOfStrings;       /* Number of valid entries in String */
+    uint8_t         First[STRINGTYPE_MAX + 1U]; /* Entry of the first string of each StringType, DEFAULTVAL_UINT8 if none */
+    Ipl_IpfString_t String[STRING_MAX_INDEX]; /* All string headers in file order */
+#ifdef IPL_USE_HOSTCRC
+    Ipl_IpfCrc_t    Crc;                /* CRCs of the string calculated last */
+#endif
+} Ipl_IpfIndex_t;
+
+
+/* Meta data decoded from an IPF file, reused as long as the META string does not change */
+typedef struct Ipl_MetaCache_
+{
+    uint8_t        Valid;               /* IPL_HIGH if Meta is filled */
+    uint8_t        ChipID;              /* ChipID of the IPF file */
+    uint32_t       lData;               /* Length of the IPF data */
+    uint32_t       Hash;                /* Hash of the META string */
+    Ipl_MetaData_t Meta;
+} Ipl_MetaCache_t;
+
+
+/* Data derived from IPF file. The parser keeps all its state here. Only with IPL_DATACHUNK_SIZE 0
+   separate contexts can parse whole IPF images in parallel threads. In chunk mode every context reads
+   the data through the chunk buffer and chunk cache in Ipl_IplData, which are not reentrant, so all
+   contexts have to be used from the thread that runs Ipl_Prog(). */
 typedef struct Ipl_IpfData_
 {
+    uint8_t        ProgChipID;          /* ChipID the IPF data has to be for, as passed to Ipl_ClrIpfData() */
     uint32_t       ProgAddr;            /* Address of data as referred in INIC Programming Guide */
     uint32_t       StringSize;          /* Size of data as referred in INIC Programming Guide */
     uint32_t       StringOffset;        /* Offset of data */
     uint8_t        StringType;          /* Type of String */
     uint8_t        ChipID;              /* ChipID from IPF file as referred in INIC Programming Guide */
     Ipl_MetaData_t Meta;
+    Ipl_IpfIndex_t Index;
+    Ipl_MetaCache_t MetaCache;
 } Ipl_IpfData_t;
 
 
@@ -178,8 +241,14 @@ extern Ipl_IpfData_t Ipl_IpfData;
 /*------------------------------------------------------------------------------------------------*/
 
 uint8_t Ipl_ParseIpf(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
-void    Ipl_ClrIpfData(Ipl_IpfData_t *ipf);
+void    Ipl_ClrIpfData(Ipl_IpfData_t *ipf, uint8_t chipID);
 void    Ipl_ClrMetaData(Ipl_IpfData_t *ipf);
+uint8_t Ipl_SetDefaultMetaProps(Ipl_IpfData_t *ipf);
+uint8_t Ipl_CheckChipId(const Ipl_IpfData_t *ipf);
+uint8_t Ipl_CheckInicFwVersion(const Ipl_IpfData_t *ipf);
+#ifdef IPL_USE_HOSTCRC
+const Ipl_IpfCrc_t* Ipl_GetIpfCrc(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
+#endif
 
 
 #endif
@@ -67,6 +67,10 @@
 #error "ipl_cfg.h: IPL_DATACHUNK_SIZE must be at least 2048 (or 0)."
 #endif
 
+#if defined IPL_USE_INTPIN_EDGE && !defined IPL_USE_INTPIN
+#error "ipl_cfg.h: IPL_USE_INTPIN_EDGE requires IPL_USE_INTPIN to be defined."
+#endif
+
 #ifndef IPL_USE_OS81118
 #ifndef IPL_USE_OS81119
 #ifndef IPL_USE_OS81210
@@ -120,7 +124,9 @@
 /* MAXIMUM LENGTHS                                                                                */
 /*------------------------------------------------------------------------------------------------*/
 
-#define INIC_MAX_TELLEN                 36U /* Meta.BmMaxDataLength + 4 */
+#define INIC_MAX_TELLEN                 IPL_TEL_MAXLEN /* Meta.BmMaxDataLength + 4 */
+#define INIC_STD_DATALEN                32U /* Meta.BmMaxDataLength of the released bootloaders */
+#define INIC_MAX_BATCH                  8U /* Telegrams queued by Ipl_QueueInicCmd() */
 #define INIC_MAX_PATCHSTRINGSIZE        64U
 #define INIC_MAX_TESTMEMSIZE            768U /*  OS8121x */
 #define INIC_MAX_OTPMEMSIZE             0x01FFU /* Address range from ReadOTPMemory command */
@@ -134,6 +140,7 @@
 #define INIC_MAX_EXTIOREGNUM            0xFFU
 #define INIC_MAX_CPUREGNUM              0x07U
 #define TOOL_MAX_TYPELEN                80U
+#define INIC_MAX_CMDSTAT                16U /* Number of commands for which response times are collected */
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -191,6 +198,7 @@
 #define CMD_GETCRC                      0xE6U
 #define CMD_GETCRC_TXLEN                4U
 #define CMD_GETCRC_RXLEN                6U
+#define IPL_CRC_POLY                    0x8408U /* CRC-16/KERMIT (0x1021 reflected), start value 0 after CMD_CLEARCRC */
 #define CMD_LEG_READFWVER               0xE4U
 #define CMD_LEG_READFWVER_TXLEN         4U
 #define CMD_LEG_READFWVER_RXLEN         19U
@@ -240,23 +248,32 @@
 /*------------------------------------------------------------------------------------------------*/
 
 #define TRACELINE_MAXLEN                200U
+#define TELTRACE_MAXLEN                 ((INIC_MAX_TELLEN * 3U) + 4U)
 #define DIR_TX                          0U
 #define DIR_RX                          1U
 #define IPL_LOW                         0U
 #define IPL_HIGH                        1U
 
 /*------------------------------------------------------------------------------------------------*/
-/* INIC TIMING VALUES (IN MILLISECONDS)                                                           */
+/* INIC TIMING VALUES (IN MICROSECONDS)                                                           */
 /*------------------------------------------------------------------------------------------------*/
 
-#define INIC_PIN_WAIT_TIME              10U   /* Time to wait before continueing after pin has been set */
-#define INIC_RESP_WAIT_TIME             1U    /* Time to wait before reading response from INIC */
-#define INIC_INT_WAIT_TIMEOUT           200U  /* Timeout for INT pin getting low */
-#define INIC_BOOTUP_TIME                12U   /* Time to wait after INIC reset before sending 1st command */
-#define INIC_PROGRAM_WAIT_TIME          10U   /* Time to wait after a programming command was sent */
-#define INIC_PROGRAM_ADDWAIT_TIME       5U    /* Additional time for legacy INICs */
-#define INIC_ERASEPROGMEM_WAIT_TIME     5000U /* Time to wait after an erase prog mem command was sent */
-#define INIC_ERASEINFOMEM_WAIT_TIME     1100U /* Time to wait after an erase info mem command was sent */
+#define INIC_PIN_WAIT_TIME              10000U   /* Time to wait before continueing after pin has been set */
+#define INIC_RESP_WAIT_TIME             1000U    /* Time to wait before reading response from INIC */
+#define INIC_INT_WAIT_TIMEOUT           200000U  /* Timeout for INT pin getting low */
+#define INIC_INT_POLL_TIME              100U     /* Interval for reading the INT pin */
+#define INIC_BOOTUP_TIME                12000U   /* Time to wait after INIC reset before sending 1st command */
+#define INIC_STARTUP_PROBE_TIME         500U     /* Interval for probing the bootloader after INIC reset */
+#define INIC_PROGRAM_WAIT_TIME          10000U   /* Time to wait after a programming command was sent */
+#define INIC_PROGRAM_ADDWAIT_TIME       5000U    /* Additional time for legacy INICs */
+#define INIC_ERASEPROGMEM_WAIT_TIME     5000000U /* Time to wait after an erase prog mem command was sent */
+#define INIC_ERASEINFOMEM_WAIT_TIME     1100000U /* Time to wait after an erase info mem command was sent */
+#define INIC_POLL_START_TIME            100U     /* First backoff step of completion polling */
+#define INIC_POLL_MAX_STEP_TIME         64000U   /* Largest backoff step of completion polling */
+#define INIC_ERASE_POLL_TIME            10000U   /* Interval for checking the completion of an erase command */
+#define INIC_CALIB_MARGIN_TIME          100U     /* Fixed margin added to the tuned times */
+#define INIC_CALIB_STEP_TIME            100U     /* Interval for reading the response of a measured command */
+#define INIC_CALIB_RUNS                 4U       /* Number of measurements per time, the longest one is used */
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -275,16 +292,66 @@
 /* TYPES                                                                                          */
 /*------------------------------------------------------------------------------------------------*/
 
+typedef struct Ipl_CmdStat_
+{
+    uint8_t  Cmd;                  /*!< \internal INIC command, 0x00 if entry is unused                       */
+    uint32_t Count;                /*!< \internal Number of executions of the command                         */
+    uint32_t SumTime;              /*!< \internal Sum of all response times in us                             */
+    uint32_t MinTime;              /*!< \internal Shortest response time in us                                */
+    uint32_t MaxTime;              /*!< \internal Longest response time in us                                 */
+    uint32_t DoneCount;            /*!< \internal Number of executions whose completion was detected by polling */
+    uint32_t DoneMaxTime;          /*!< \internal Longest response time in us whose completion was detected    */
+} Ipl_CmdStat_t;
+
+
+#ifdef IPL_CHUNKCACHE_SLOTS
+typedef struct Ipl_ChunkSlot_
+{
+    uint8_t  Valid;                       /*!< \internal IPL_HIGH if Data holds the chunk at Offset         */
+    uint32_t Offset;                      /*!< \internal Start index of the chunk in the IPF data           */
+    uint32_t LastUse;                     /*!< \internal Value of ChunkTick when the chunk was used last     */
+    uint8_t  Data[IPL_DATACHUNK_SIZE];    /*!< \internal Copy of the chunk                                  */
+} Ipl_ChunkSlot_t;
+#endif
+
+
 typedef struct Ipl_IplData_
 {
     uint8_t  Tel[INIC_MAX_TELLEN]; /*!< \internal Message Buffer for message to (TX) and from (RX) INIC       */
     uint8_t  TelLen;               /*!< \internal Length of the sent/received message                         */
     uint8_t  ChipID;               /*!< \internal ChipID as referred in INIC Programming Guide                */
-    uint16_t IntTime;              /*!< \internal Time elapsed until INT pin toggled                          */
+    uint32_t IntTime;              /*!< \internal Time (in us) elapsed until INT pin toggled                  */
+    uint32_t BootTime;             /*!< \internal Time (in us) until the bootloader acknowledged, if probed   */
     uint8_t  ChipMode;             /*!< \internal Current INIC mode (INICMODE_BOOT or INICMODE_NORMAL         */
 
     uint32_t ChunkOffset;
     uint8_t* pData;
+#if IPL_DATACHUNK_SIZE > 0
+    uint8_t  ChunkErr;             /*!< \internal IPL_HIGH if a data chunk could not be provided during the job */
+#endif
+#ifdef IPL_USE_STREAMING
+    uint32_t ChunkNext;            /*!< \internal Offset of the first chunk not provided yet                  */
+#endif
+#ifdef IPL_CHUNKCACHE_SLOTS
+    Ipl_ChunkSlot_t ChunkCache[IPL_CHUNKCACHE_SLOTS]; /*!< \internal Chunks kept for later accesses         */
+    uint8_t*        pCachedData;                      /*!< \internal IPF data the cached chunks belong to   */
+    uint32_t        CachedLData;                      /*!< \internal Length of that IPF data                */
+    uint32_t        ChunkTick;                        /*!< \internal Counts chunk accesses for the LRU order */
+    uint32_t        ChunkHits;                        /*!< \internal Chunks found in the cache              */
+    uint32_t        ChunkMisses;                      /*!< \internal Chunks requested from the application  */
+#endif
+    uint8_t  RxPolled;             /*!< \internal IPL_HIGH if the response was already read                  */
+    uint8_t  RxRes;                /*!< \internal Result of the read if the response was already read        */
+#ifdef IPL_USE_INICTRANSFER
+    uint8_t  TxCmd;                /*!< \internal Command of the sent telegram                               */
+#endif
+#ifdef IPL_USE_INICBATCH
+    Ipl_Telegram_t Batch[INIC_MAX_BATCH];     /*!< \internal Telegrams queued by Ipl_QueueInicCmd()           */
+    uint8_t        BatchLen;                  /*!< \internal Number of queued telegrams                       */
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+    Ipl_CmdStat_t CmdStat[INIC_MAX_CMDSTAT];  /*!< \internal Response times per command                        */
+#endif
 } Ipl_IplData_t;
 
 
@@ -318,15 +385,28 @@ extern Ipl_InicData_t Ipl_InicData;
 /*------------------------------------------------------------------------------------------------*/
 
 uint8_t Ipl_ExecInicCmd(void);
+uint8_t Ipl_ExecInicCmdBatch(Ipl_Telegram_t tel[], uint8_t num);
+uint8_t Ipl_QueueInicCmd(void);
+uint8_t Ipl_FlushInicCmds(void);
+uint8_t Ipl_ReadFirmwareVersion(void);
+uint8_t Ipl_MeasureInicCmd(uint32_t* pTime);
+uint8_t Ipl_MeasureStartup(uint32_t* pBootTime, uint32_t* pRespTime);
 void    Ipl_ClrTel(void);
+uint8_t Ipl_GetDataLen(void);
 void    Ipl_ProgressIndicator(uint32_t val, uint32_t fval);
-uint8_t Ipl_CheckChipId(void);
-uint8_t Ipl_CheckInicFwVersion(void);
 char*   Ipl_TraceTag(uint8_t  result);
 char    Ipl_Bcd2Char(uint8_t val, uint8_t lowHigh);
 uint8_t Ipl_ClrPData(uint32_t lData, uint8_t pData[]);
 uint8_t Ipl_PData(uint32_t index, uint32_t lData, uint8_t pData[]);
+uint8_t* Ipl_PDataSpan(uint32_t index, uint32_t* pLen, uint32_t lData, uint8_t pData[]);
+uint8_t Ipl_CopyPData(uint8_t dest[], uint32_t index, uint32_t len, uint32_t lData, uint8_t pData[]);
 void    Ipl_ExportChipInfo(void);
+#ifdef IPL_USE_HOSTCRC
+uint16_t Ipl_CalcCrc(uint16_t crc, const uint8_t pBuf[], uint32_t len);
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+const Ipl_CmdStat_t* Ipl_GetCmdStat(uint8_t cmd);
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -29,6 +29,7 @@
 
 #include <stdint.h>
 #include "ipl_cfg.h"
+#include "ipl_pb.h"
 
 
 /* INICnet technology 150 */
@@ -42,6 +43,7 @@
 uint8_t OS81118_ReadConfigStringVersion(uint32_t lData, uint8_t pData[]);
 uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[]);
 uint8_t OS81118_ProgConfiguration(uint32_t lData, uint8_t pData[]);
+uint8_t OS81118_MeasureTiming(Ipl_TimingProfile_t *pTime);
 
 uint8_t OS81118_ProgPatchString(uint32_t lData, uint8_t pData[]);
 uint8_t OS81118_ProgTestConfiguration(uint32_t lData, uint8_t pData[]);
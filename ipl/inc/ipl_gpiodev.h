@@ -0,0 +1,88 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_gpiodev.h
+ *  \brief  Linux GPIO character device transport for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#ifndef IPL_GPIODEV_H
+#define IPL_GPIODEV_H
+
+#include <stdint.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+#ifdef IPL_USE_GPIODEV
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \brief Line offset to be used if INIC's INT_ pin is not connected. */
+#define IPL_GPIODEV_NOLINE                  0xFFFFFFFFU
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \defgroup gpiodev Linux GPIO Character Device Transport
+ * Transport functions for INIC's RESET_, ERR/BOOT_ and INT_ pins on Linux. Enabled by ::IPL_USE_GPIODEV.
+ * All lines are requested once with one line request and stay requested until ::Ipl_GpioDevClose() is called.
+ */
+/*!@{*/
+
+/*! \brief Requests the lines and fills in the pin functions of the referred transport.
+ *
+ *  RESET_ and ERR/BOOT_ are requested as outputs (initially released), INT_ as input with falling edge detection.
+ *  ::IPL_TRP_CAP_SETPINS is set, ::IPL_TRP_CAP_INTPIN and ::IPL_TRP_CAP_INTEDGE are set if INT_ is connected.
+ *  I2C and sleep functions of the transport are not changed.
+ *  \param pTransport Pointer to the transport to be filled in
+ *  \param pChip      Path of the GPIO chip, e.g. "/dev/gpiochip0"
+ *  \param resetLine  Line offset of RESET_ on the chip
+ *  \param bootLine   Line offset of ERR/BOOT_ on the chip
+ *  \param intLine    Line offset of INT_ on the chip or ::IPL_GPIODEV_NOLINE
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|-----------------------------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_HW_INIC_PINS   | Chip could not be opened or lines not requested
+ */
+uint8_t Ipl_GpioDevOpen(Ipl_Transport_t* pTransport, const char* pChip, uint32_t resetLine, uint32_t bootLine, uint32_t intLine);
+
+/*! \brief Releases the lines.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_HW_INIC_PINS   | Lines were not requested
+ */
+uint8_t Ipl_GpioDevClose(void);
+
+/*! \brief Returns the errno of the last failed GPIO access (0 if none), e.g. for diagnostics after an error. */
+int Ipl_GpioDevGetErrno(void);
+
+/*!@}*/
+
+#endif
+#endif
@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_i2cdev.h
+ *  \brief  Linux i2c-dev transport for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#ifndef IPL_I2CDEV_H
+#define IPL_I2CDEV_H
+
+#include <stdint.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+#ifdef IPL_USE_I2CDEV
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \defgroup i2cdev Linux i2c-dev Transport
+ * Transport functions for INIC's I2C port on Linux. Enabled by ::IPL_USE_I2CDEV.
+ * The device is opened once and stays open until ::Ipl_I2cDevClose() is called.
+ */
+/*!@{*/
+
+/*! \brief Opens the I2C device and fills in the I2C and sleep functions of the referred transport.
+ *
+ *  The function detects with I2C_FUNCS whether the adapter supports combined transfers (I2C_RDWR).
+ *  If so, ::IPL_TRP_CAP_TRANSFER and ::IPL_TRP_CAP_BATCH are set in Ipl_Transport_t::Caps, otherwise they are cleared.
+ *  ::IPL_TRP_CAP_SLEEPUS is always set. Pin functions of the transport are not changed.
+ *  \param pTransport Pointer to the transport to be filled in
+ *  \param pDevice    Path of the I2C device, e.g. "/dev/i2c-1"
+ *  \param address    7 bit I2C address of INIC, e.g. 0x20
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|----------------------------------------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_HW_INIC_COM    | Device could not be opened or address could not be set
+ */
+uint8_t Ipl_I2cDevOpen(Ipl_Transport_t* pTransport, const char* pDevice, uint8_t address);
+
+/*! \brief Closes the I2C device.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_HW_INIC_COM    | Device was not open
+ */
+uint8_t Ipl_I2cDevClose(void);
+
+/*! \brief Returns the errno of the last failed I2C access (0 if none), e.g. for diagnostics after an error. */
+int Ipl_I2cDevGetErrno(void);
+
+/*!@}*/
+
+#endif
+#endif
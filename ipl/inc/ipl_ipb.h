@@ -0,0 +1,129 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_ipb.h
+ *  \brief  Multi-chip IPF bundle (IPB) for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#ifndef IPL_IPB_H
+#define IPL_IPB_H
+
+#include <stdint.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+#ifdef IPL_USE_IPB
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \defgroup ipb Multi-Chip IPF Bundle
+ * An IPB bundle holds several IPF files for different INICs, firmware and ConfigString versions.
+ * All values are big endian like in the IPF format.
+ *
+ * Offset             | Size   | Content
+ * -------------------|--------|---------------------------------------------------------------
+ * 0                  | 4      | Magic 'I', 'P', 'B', version (::IPB_VERSION)
+ * 4                  | 4      | Length of the bundle
+ * 8                  | 4      | Number of members n (1...255)
+ * 12                 | 4      | Reserved (0)
+ * 16                 | 2*256  | Chip table, for each ChipID the index of its first member and the number of its members
+ * 528                | 16*n   | Member entries, see below
+ * 528+16*n           | ...    | Member data, each one an unchanged IPF file
+ *
+ * Member entry       | Size   | Content
+ * -------------------|--------|---------------------------------------------------------------
+ * 0                  | 1      | ChipID
+ * 1                  | 3      | FwMajorVersion, FwMinorVersion, FwReleaseVersion (0xFF if the IPF holds no firmware)
+ * 4                  | 3      | CfgsCustMajorVersion, CfgsCustMinorVersion, CfgsCustReleaseVersion (0xFF if no ConfigString)
+ * 7                  | 1      | Reserved (0)
+ * 8                  | 4      | Offset of the IPF data in the bundle
+ * 12                 | 4      | Length of the IPF data
+ *
+ * The members of a ChipID follow each other, the newest one first. The ChipID indexes the chip table
+ * directly, so the lookup does not depend on the number of members. Bundles are created on the host
+ * with the ipbpack tool.
+ */
+/*!@{*/
+
+#define IPB_VERSION     0x01U   /*!< \brief Version of the bundle format */
+#define IPB_HEADER_LEN  528U    /*!< \brief Length of the bundle header including the chip table */
+#define IPB_ENTRY_LEN   16U     /*!< \brief Length of a member entry */
+#define IPB_ANY         0xFFU   /*!< \brief Ipl_IpbMember_t value that matches every member */
+
+/*! \brief Length of header and index of a bundle with n members, this part has to be in memory for ::Ipl_IpbSelect(). */
+#define IPB_INDEX_LEN(n) (IPB_HEADER_LEN + ((uint32_t) (n) * IPB_ENTRY_LEN))
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* TYPES                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \brief Member of an IPF bundle, used as filter and result of ::Ipl_IpbSelect(). */
+typedef struct Ipl_IpbMember_
+{
+    uint8_t  ChipID;                  /*!< \brief INIC identifier, ::IPB_ANY selects the connected INIC. */
+    uint8_t  FwMajorVersion;          /*!< \brief Firmware major version. */
+    uint8_t  FwMinorVersion;          /*!< \brief Firmware minor version. */
+    uint8_t  FwReleaseVersion;        /*!< \brief Firmware release version. */
+    uint8_t  CfgsCustMajorVersion;    /*!< \brief ConfigString customer major version. */
+    uint8_t  CfgsCustMinorVersion;    /*!< \brief ConfigString customer minor version. */
+    uint8_t  CfgsCustReleaseVersion;  /*!< \brief ConfigString customer release version. */
+    uint32_t Offset;                  /*!< \brief Offset of the IPF data in the bundle. */
+    uint32_t Length;                  /*!< \brief Length of the IPF data in bytes. */
+} Ipl_IpbMember_t;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \brief Selects the member of an IPF bundle that fits to the connected INIC.
+ *
+ *  To be called after ::Ipl_EnterProgMode(), which reads the ChipID of the connected INIC.
+ *  The version fields of pMember are used as filter, ::IPB_ANY matches every version. Of the
+ *  fitting members the first (newest) one is returned in pMember. Its IPF data starts at
+ *  pIpb[Offset] and is used with ::Ipl_Prog() like a single IPF file. With
+ *  ::IPL_DATACHUNK_SIZE > 0, ::Ipl_ProvideDataChunk() has to add Offset to the requested index.
+ *  Only the bundle header and index (::IPB_INDEX_LEN) have to be in memory at pIpb, the bundle
+ *  is best mapped (e.g. mmap or memory mapped flash) so that the member needs no copy.
+ *  If the ChipID of the member differs from the one passed to ::Ipl_EnterProgMode() (another INIC
+ *  of the same family), ::Ipl_EnterProgMode() has to be called again with the ChipID of the member.
+ *  \param pIpb    Pointer to the bundle
+ *  \param lIpb    Length of the bundle in bytes
+ *  \param pMember Filter on input, selected member on output
+ *  \return Possible result values:
+ *  Value                          | Description
+ *  -------------------------------|----------------------------------------------------------
+ *  ::IPL_RES_OK                   | No error occured
+ *  ::IPL_RES_ERR_IPF_INVALID      | Bundle header or index is invalid
+ *  ::IPL_RES_ERR_NOVALIDCHIPID    | ChipID of the connected INIC could not be read
+ *  ::IPL_RES_ERR_IPF_WRONGINIC    | The bundle holds no member for the ChipID and versions
+ */
+uint8_t Ipl_IpbSelect(const uint8_t pIpb[], uint32_t lIpb, Ipl_IpbMember_t* pMember);
+
+/*!@}*/
+
+#endif
+#endif
@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_ipz.h
+ *  \brief  Compressed IPF container (IPZ) for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#ifndef IPL_IPZ_H
+#define IPL_IPZ_H
+
+#include <stdint.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+#ifdef IPL_USE_IPZ
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/*!
+ * \defgroup ipz Compressed IPF Container
+ * An IPZ container holds an IPF file split into blocks of ::IPL_DATACHUNK_SIZE bytes, each block
+ * compressed on its own. All values are big endian like in the IPF format.
+ *
+ * Offset             | Size | Content
+ * -------------------|------|---------------------------------------------------------------
+ * 0                  | 4    | Magic 'I', 'P', 'Z', version (::IPZ_VERSION)
+ * 4                  | 4    | Length of the original IPF data
+ * 8                  | 4    | Block size, has to be equal to ::IPL_DATACHUNK_SIZE
+ * 12                 | 4    | Number of blocks n
+ * 16                 | 6    | Copy of the IPF file header (ChipID at offset 17)
+ * 22                 | 2    | Reserved (0)
+ * 24                 | 4*(n+1) | Offset of each block in the container, the last entry is the container length
+ *
+ * A block that is as long as its original data is stored uncompressed. All other blocks use the
+ * LZ4 block format. The decompressed data is the unchanged IPF, so all IPF string headers are kept.
+ * Containers are created on the host with the ipzpack tool.
+ */
+/*!@{*/
+
+#define IPZ_VERSION     0x01U /*!< \brief Version of the container format */
+#define IPZ_HEADER_LEN  24U   /*!< \brief Length of the container header before the block index */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \brief Opens an IPZ container. Until ::Ipl_IpzClose() is called, IPL decompresses the data chunks
+ *         from the container instead of calling ::Ipl_ProvideDataChunk() and ::Ipl_PrefetchDataChunk().
+ *
+ *  The container has to stay accessible (e.g. in memory mapped flash) while it is open.
+ *  Afterwards the jobs are started with ::Ipl_Prog(), referring the length of the original IPF data
+ *  and the pointer to the container.
+ *  \param pIpz  Pointer to the container
+ *  \param lIpz  Length of the container in bytes
+ *  \param pLData Returns the length of the original IPF data
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|----------------------------------------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_IPF_INVALID    | Container header or block index is invalid, or the block size is not ::IPL_DATACHUNK_SIZE
+ */
+uint8_t Ipl_IpzOpen(const uint8_t pIpz[], uint32_t lIpz, uint32_t* pLData);
+
+/*! \brief Closes the IPZ container, IPL calls ::Ipl_ProvideDataChunk() again.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|------------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_NOT_SUPPORTED  | No container was open
+ */
+uint8_t Ipl_IpzClose(void);
+
+/*!@}*/
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* INTERNAL FUNCTION PROTOTYPES                                                                   */
+/*------------------------------------------------------------------------------------------------*/
+
+uint8_t  Ipl_IpzIsOpen(void);
+uint8_t* Ipl_IpzLoadChunk(uint32_t sIndex, uint8_t dest[]);
+
+#endif
+#endif
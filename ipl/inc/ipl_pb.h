@@ -39,6 +39,54 @@
 #error "ipl_cfg.h: IPL_DATACHUNK_SIZE needs to be defined."
 #endif
 
+#ifndef IPL_MAX_DATALENGTH
+#define IPL_MAX_DATALENGTH 32U
+#endif
+
+#if (IPL_MAX_DATALENGTH < 32U) || (IPL_MAX_DATALENGTH > 251U)
+#error "ipl_cfg.h: IPL_MAX_DATALENGTH needs to be in the range 32...251."
+#endif
+
+#if defined IPL_USE_CHUNK_PREFETCH && (IPL_DATACHUNK_SIZE == 0)
+#error "ipl_cfg.h: IPL_USE_CHUNK_PREFETCH requires IPL_DATACHUNK_SIZE > 0."
+#endif
+
+#if defined IPL_CHUNKCACHE_SLOTS && (IPL_DATACHUNK_SIZE == 0)
+#error "ipl_cfg.h: IPL_CHUNKCACHE_SLOTS requires IPL_DATACHUNK_SIZE > 0."
+#endif
+
+#if defined IPL_CHUNKCACHE_SLOTS && ((IPL_CHUNKCACHE_SLOTS < 2) || (IPL_CHUNKCACHE_SLOTS > 16))
+#error "ipl_cfg.h: IPL_CHUNKCACHE_SLOTS needs to be in the range 2...16."
+#endif
+
+#if defined IPL_USE_IPZ && (IPL_DATACHUNK_SIZE == 0)
+#error "ipl_cfg.h: IPL_USE_IPZ requires IPL_DATACHUNK_SIZE > 0."
+#endif
+
+#if defined IPL_USE_STREAMING && !defined IPL_CHUNKCACHE_SLOTS
+#error "ipl_cfg.h: IPL_USE_STREAMING requires IPL_CHUNKCACHE_SLOTS."
+#endif
+
+#if defined IPL_USE_HOSTCRC && defined IPL_USE_STREAMING
+#error "ipl_cfg.h: IPL_USE_HOSTCRC cannot be used with IPL_USE_STREAMING."
+#endif
+
+#if defined IPL_USE_SKIP_IDENTICAL_FW && defined IPL_USE_STREAMING
+#error "ipl_cfg.h: IPL_USE_SKIP_IDENTICAL_FW cannot be used with IPL_USE_STREAMING."
+#endif
+
+#if defined IPL_USE_SKIP_IDENTICAL_FW && !defined IPL_USE_HOSTCRC
+#error "ipl_cfg.h: IPL_USE_SKIP_IDENTICAL_FW requires IPL_USE_HOSTCRC."
+#endif
+
+#if defined IPL_USE_I2CDEV && !defined IPL_USE_TRANSPORT
+#error "ipl_cfg.h: IPL_USE_I2CDEV requires IPL_USE_TRANSPORT."
+#endif
+
+#if defined IPL_USE_GPIODEV && !defined IPL_USE_TRANSPORT
+#error "ipl_cfg.h: IPL_USE_GPIODEV requires IPL_USE_TRANSPORT."
+#endif
+
 
 /*------------------------------------------------------------------------------------------------*/
 /* CONSTANTS                                                                                      */
@@ -364,6 +412,13 @@
  */
 #define IPL_RES_ERR_INVALID_DATACHUNK       0x89U
 
+/*! \brief Error. No valid transport is registered.
+ *
+ *  Please check the transport passed to ::Ipl_SetTransport().
+ *  Parameter is returned by IPL.
+ */
+#define IPL_RES_ERR_INVALID_TRANSPORT       0x8AU
+
 /*! \brief Error. Connected INIC does not fit the parameter given in ::Ipl_EnterProgMode().
  *
  *  Please check connected INIC.
@@ -637,6 +692,20 @@
  */
 #define IPL_JOB_CHK_UPDATE_FIRMWARE        0x0DU
 
+/*! \brief Measures the timing of the connected INIC and tunes its timing profile.
+ *
+ *  No IPF data is required. INIC is reset several times, the bootup time is measured by probing the
+ *  bootloader and the response wait time by the response times of the programming mode and firmware
+ *  version commands. On OS81118 and OS81119 the program and erase times are measured on the last program
+ *  memory section and the info memory, but only if they read back erased, so no content is lost. Writing
+ *  the info memory also counts for the response wait time. Each time is the longest one measured plus 25%
+ *  and a small margin. Times that are not measured keep their default value, this is traced as error.
+ *  OTP INICs do not use the program and erase times. INIC stays in programming mode.
+ *  The tuned profile is used until ::Ipl_EnterProgMode() is called for another INIC and can be read by
+ *  ::Ipl_GetTimingProfile() to be stored by the application.
+ */
+#define IPL_JOB_CALIBRATE_TIMING           0x0EU
+
 /*! \brief This option adds 3 jobs to only check the IPF content. */
 #ifdef IPL_CHK_IPF_JOBS
 /*! \brief Checks if the IPF data contains config string. */
@@ -664,6 +733,29 @@
 /*!@}*/
 
 
+/*!
+ * \defgroup transport_caps Transport Capabilities
+ * These flags are used in Ipl_Transport_t::Caps to advertise the optional functions of a transport.
+ * A capability is only used if the respective feature is also enabled in ipl_cfg.h.
+ */
+/*!@{*/
+
+/*! \brief Ipl_Transport_t::InicTransfer is available (see ::IPL_USE_INICTRANSFER). */
+#define IPL_TRP_CAP_TRANSFER                0x01U
+/*! \brief Ipl_Transport_t::InicTransferBatch is available (see ::IPL_USE_INICBATCH). */
+#define IPL_TRP_CAP_BATCH                   0x02U
+/*! \brief Ipl_Transport_t::SleepUs is available (see ::IPL_USE_SLEEPUS). */
+#define IPL_TRP_CAP_SLEEPUS                 0x04U
+/*! \brief Ipl_Transport_t::GetIntPin is available (see ::IPL_USE_INTPIN). */
+#define IPL_TRP_CAP_INTPIN                  0x08U
+/*! \brief Ipl_Transport_t::WaitIntEdge is available (see ::IPL_USE_INTPIN_EDGE). */
+#define IPL_TRP_CAP_INTEDGE                 0x10U
+/*! \brief Ipl_Transport_t::SetPins is available. */
+#define IPL_TRP_CAP_SETPINS                 0x20U
+
+/*!@}*/
+
+
 /*------------------------------------------------------------------------------------------------*/
 /* TYPES                                                                                          */
 /*------------------------------------------------------------------------------------------------*/
@@ -681,6 +773,66 @@ typedef struct Ipl_Inic_
 } Ipl_Inic_t;
 
 
+/*! \brief Timing profile of an INIC. All times are in microseconds.
+ *
+ *  Without ::IPL_USE_SLEEPUS the times are rounded up to full milliseconds when IPL sleeps.
+ */
+typedef struct Ipl_TimingProfile_
+{
+    uint32_t RespWaitTime;            /*!< \brief Time to wait before reading a response from INIC. */
+    uint32_t ProgramWaitTime;         /*!< \brief Time to wait after a programming command was sent. */
+    uint32_t EraseProgMemWaitTime;    /*!< \brief Time to wait after an erase program memory command was sent. */
+    uint32_t EraseInfoMemWaitTime;    /*!< \brief Time to wait after an erase info memory command was sent. */
+    uint32_t BootupTime;              /*!< \brief Time to wait after INIC reset before sending the first command. */
+} Ipl_TimingProfile_t;
+
+
+/*! \brief Maximum length (in bytes) of a telegram to or from INIC, see ::IPL_MAX_DATALENGTH. */
+#define IPL_TEL_MAXLEN                      (IPL_MAX_DATALENGTH + 4U)
+
+
+/*! \brief Telegram executed by ::Ipl_InicTransferBatch().
+ *
+ *  TxLen, RxLen, DelayUs, PollUs and Tx are prepared by IPL. Rx, Res and TimeUs are set by the callback.
+ */
+typedef struct Ipl_Telegram_
+{
+    uint8_t  TxLen;                   /*!< \brief Length of the telegram (in bytes) to be sent. */
+    uint8_t  RxLen;                   /*!< \brief Length of the response (in bytes) to be read. */
+    uint32_t DelayUs;                 /*!< \brief Time (in us) to wait between sending and reading, the timeout if PollUs is not 0. */
+    uint32_t PollUs;                  /*!< \brief First polling step (in us), 0 = read once after DelayUs. */
+    uint32_t TimeUs;                  /*!< \brief Time (in us) waited until the response was read. */
+    uint8_t  Res;                     /*!< \brief Result: 0 = ok, 1 = error on sending, 2...255 = error on reading. */
+    uint8_t  Tx[IPL_TEL_MAXLEN];      /*!< \brief Telegram to be sent. */
+    uint8_t  Rx[IPL_TEL_MAXLEN];      /*!< \brief Response read from INIC. */
+} Ipl_Telegram_t;
+
+
+/*! \brief Transport (hardware backend) registered by ::Ipl_SetTransport().
+ *
+ *  The function pointers have the same meaning as the respective callback functions.
+ *  Optional functions can be NULL if the respective capability is not advertised in Caps.
+ */
+typedef struct Ipl_Transport_
+{
+    uint8_t  Caps;                                             /*!< \brief Capabilities, see \ref transport_caps. */
+    uint8_t  MaxTelLen;                                        /*!< \brief Longest telegram (in bytes) the transport can send. 0 = ::IPL_TEL_MAXLEN. */
+    uint8_t  (*SetResetPin)(uint8_t lowHigh);                  /*!< \brief See ::Ipl_SetResetPin(). */
+    uint8_t  (*SetErrBootPin)(uint8_t lowHigh);                /*!< \brief See ::Ipl_SetErrBootPin(). */
+    uint8_t  (*SetPins)(uint8_t resetLowHigh, uint8_t errBootLowHigh); /*!< \brief Optional. Sets RESET_ and ERR/BOOT_ at the same time, returns like ::Ipl_SetResetPin(). */
+    uint8_t  (*InicRead)(uint8_t lData, uint8_t* pData);       /*!< \brief See ::Ipl_InicRead(). */
+    uint8_t  (*InicWrite)(uint8_t lData, uint8_t* pData);      /*!< \brief See ::Ipl_InicWrite(). */
+    void     (*Sleep)(uint16_t timeMs);                        /*!< \brief See ::Ipl_Sleep(). */
+    void     (*SleepUs)(uint32_t timeUs);                      /*!< \brief Optional, see ::Ipl_SleepUs(). */
+    uint8_t  (*GetIntPin)(void);                               /*!< \brief Optional, see ::Ipl_GetIntPin(). */
+    uint8_t  (*WaitIntEdge)(uint32_t timeoutUs, uint32_t* pElapsedUs);                                 /*!< \brief Optional, see ::Ipl_WaitIntEdge(). */
+    uint8_t  (*InicTransfer)(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs); /*!< \brief Optional, see ::Ipl_InicTransfer(). */
+    uint8_t  (*InicTransferBatch)(uint8_t num, Ipl_Telegram_t tel[]);                                  /*!< \brief Optional, see ::Ipl_InicTransferBatch(). */
+    uint8_t  (*InicDriverOpen)(void);                          /*!< \brief Optional (NULL if not needed), see ::Ipl_InicDriverOpen(). */
+    uint8_t  (*InicDriverClose)(void);                         /*!< \brief Optional (NULL if not needed), see ::Ipl_InicDriverClose(). */
+} Ipl_Transport_t;
+
+
 /*!
  * \defgroup bm Variables
  The data fields contain data that is derived from INIC's boot loader.
@@ -750,12 +902,59 @@ extern uint8_t  Ipl_InicRead(uint8_t lData, uint8_t* pData);
  *   1...255 | Error occured when data was sent
  */
 extern uint8_t  Ipl_InicWrite(uint8_t lData, uint8_t* pData);
+#ifdef IPL_USE_INICTRANSFER
+/*! \brief Hardware abstraction. Callback function to send a telegram to INIC and read the response.
+ *
+ *  Optional. Only required if sending and reading should be combined into one transfer.
+ *  Enabled by ::IPL_USE_INICTRANSFER.
+ *  The function sends the telegram, waits the referred delay and reads the response. If the delay is 0,
+ *  the response can be read with a repeated start condition.
+ *  \note pTx and pRx refer to the same buffer. The telegram needs to be sent before the response is stored.
+ *  \param txLen         Length of the telegram (in bytes) to be sent
+ *  \param pTx           Pointer to data array containing the telegram
+ *  \param rxLen         Length of the response (in bytes) to be read
+ *  \param pRx           Pointer to data array used for storing the response
+ *  \param delayUs       Time (in us) to wait between sending and reading
+ *  \return Possible result values:
+ *  Value   | Description
+ *  --------|---------------------------------------------------------
+ *  0       | No error occured
+ *  1       | Error occured when data was sent (nothing was read)
+ *  2...255 | Error occured when data was read
+ */
+extern uint8_t  Ipl_InicTransfer(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs);
+#endif
+#ifdef IPL_USE_INICBATCH
+/*! \brief Hardware abstraction. Callback function to execute several telegrams in as few transfers as possible.
+ *
+ *  Optional. Enabled by ::IPL_USE_INICBATCH.
+ *  For each telegram in order the function sends Tx, waits, reads RxLen bytes into Rx and sets Res and TimeUs.
+ *  If PollUs is 0, the response is read once after DelayUs. Otherwise it is read right after sending and,
+ *  while the read fails or returns the completion code 0x00, again after PollUs, doubling the step up to
+ *  64000 us, until DelayUs has elapsed. The next telegram is only sent after the response was read.
+ *  Telegrams with DelayUs 0 can be combined into one transfer (e.g. one multi-message I2C transfer).
+ *  The function stops after the first telegram whose Res is not 0.
+ *  \param num           Number of telegrams
+ *  \param tel           Array of telegrams
+ *  \return Number of telegrams that were processed (including the one that failed). 0 if nothing was done.
+ */
+extern uint8_t  Ipl_InicTransferBatch(uint8_t num, Ipl_Telegram_t tel[]);
+#endif
 
 
 /*! \brief Hardware abstraction. Callback function to sleep some milliseconds.
  *  \param timeMs        Time (in ms) to sleep
  */
 extern void     Ipl_Sleep(uint16_t timeMs);
+#ifdef IPL_USE_SLEEPUS
+/*! \brief Hardware abstraction. Callback function to sleep some microseconds.
+ *
+ *  Optional. Only required if waits shorter than 1 ms should be possible.
+ *  Enabled by ::IPL_USE_SLEEPUS. If enabled, IPL uses this function instead of ::Ipl_Sleep().
+ *  \param timeUs        Time (in us) to sleep
+ */
+extern void     Ipl_SleepUs(uint32_t timeUs);
+#endif
 #ifdef IPL_USE_INTPIN
 /*! \brief Hardware abstraction. Callback function to read INIC's INT_ pin status.
  *
@@ -770,6 +969,23 @@ extern void     Ipl_Sleep(uint16_t timeMs);
  */
 extern uint8_t  Ipl_GetIntPin(void);
 #endif
+#ifdef IPL_USE_INTPIN_EDGE
+/*! \brief Hardware abstraction. Callback function to wait until INIC's INT_ pin goes LOW.
+ *
+ *  Optional. Only required if INT_ pin should be evaluated edge triggered instead of polled.
+ *  Enabled by ::IPL_USE_INTPIN_EDGE.
+ *  The function needs to return immediately if the INT_ pin is already LOW.
+ *  \param timeoutUs     Maximum time (in us) to wait for the INT_ pin
+ *  \param pElapsedUs    Pointer to variable where the time (in us) actually waited is stored
+ *  \return Possible result values:
+ *  Value   | Description
+ *  --------|------------------------------------------
+ *  0       | INT_ pin is LOW
+ *  1       | INT_ pin is still HIGH after timeout
+ *  2...255 | Error occured when INT_ pin was waited for
+ */
+extern uint8_t  Ipl_WaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs);
+#endif
 /*! \brief Callback function to deliver trace information.
  *
  *  Can be left empty if no tracing is needed.
@@ -827,6 +1043,18 @@ extern uint8_t  Ipl_InicDriverClose(void);
  */
 extern uint8_t* Ipl_ProvideDataChunk(uint32_t sIndex, uint32_t lData);
 #endif
+#ifdef IPL_USE_CHUNK_PREFETCH
+/*! \brief Callback function to announce the IPF data chunk that IPL will request next.
+ *
+ *  Optional. Enabled by ::IPL_USE_CHUNK_PREFETCH. Called after each ::Ipl_ProvideDataChunk().
+ *  The application can start loading the chunk in the background and return immediately.
+ *  The buffer returned by the last ::Ipl_ProvideDataChunk() call must stay unchanged until the next call.
+ *  The announced chunk may lie behind the end of the IPF data or may not be requested at all.
+ *  \param sIndex        Start index of the byte array that will be requested next
+ *  \param lData         Length of the byte array that will be requested next
+ */
+extern void     Ipl_PrefetchDataChunk(uint32_t sIndex, uint32_t lData);
+#endif
 /*!@}*/
 
 
@@ -887,6 +1115,62 @@ uint8_t Ipl_LeaveProgMode(void);
  */
 uint8_t Ipl_Prog(uint8_t job, uint32_t lData, uint8_t* pData);
 
+/*! \brief Replaces the timing profile of the referred INIC.
+ *
+ *  Can be called at any time, the profile becomes active with the next call of ::Ipl_EnterProgMode()
+ *  or immediately if the referred INIC is already in programming mode.
+ *  \param chipID   ID of the INIC. All supported chipIDs are listed here: \ref chip_ids
+ *  \param pProfile Pointer to the timing profile to be used. NULL restores the default profile.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|-----------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_NOT_SUPPORTED  | chipID is not supported
+ */
+uint8_t Ipl_SetTimingProfile(uint8_t chipID, const Ipl_TimingProfile_t* pProfile);
+
+/*! \brief Reads the timing profile of the referred INIC, e.g. after ::IPL_JOB_CALIBRATE_TIMING has been performed.
+ *  \param chipID   ID of the INIC. All supported chipIDs are listed here: \ref chip_ids
+ *  \param pProfile Pointer to the variable where the timing profile is stored.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|-----------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_NOT_SUPPORTED  | chipID is not supported
+ */
+uint8_t Ipl_GetTimingProfile(uint8_t chipID, Ipl_TimingProfile_t* pProfile);
+
+#ifdef IPL_USE_TRANSPORT
+/*! \brief Registers the transport used for all hardware accesses.
+ *
+ *  Enabled by ::IPL_USE_TRANSPORT. Needs to be called before ::Ipl_EnterProgMode(). The transport
+ *  stays registered until another one is registered. IPL only uses the optional functions whose
+ *  capability is advertised and enabled in ipl_cfg.h, otherwise it falls back to the basic functions.
+ *  \param pTransport Pointer to the transport. The structure needs to stay valid while it is registered.
+ *  \return Possible result values:
+ *  Value                            | Description
+ *  ---------------------------------|------------------------------------------------------------
+ *  ::IPL_RES_OK                     | No error occured
+ *  ::IPL_RES_ERR_INVALID_TRANSPORT  | pTransport is NULL or lacks a function needed by its capabilities
+ */
+uint8_t Ipl_SetTransport(const Ipl_Transport_t* pTransport);
+#endif
+
+#ifdef IPL_CHUNKCACHE_SLOTS
+/*! \brief Reads how often a data chunk was found in the chunk cache since ::Ipl_EnterProgMode().
+ *
+ *  Enabled by ::IPL_CHUNKCACHE_SLOTS. Every miss is one call of ::Ipl_ProvideDataChunk().
+ *  \param pHits   Pointer to the variable where the number of cache hits is stored.
+ *  \param pMisses Pointer to the variable where the number of cache misses is stored.
+ *  \return Possible result values:
+ *  Value                        | Description
+ *  -----------------------------|-----------------------
+ *  ::IPL_RES_OK                 | No error occured
+ *  ::IPL_RES_ERR_NOT_SUPPORTED  | A pointer is NULL
+ */
+uint8_t Ipl_GetChunkCacheStats(uint32_t* pHits, uint32_t* pMisses);
+#endif
+
 /*!@}*/
 
 #endif
@@ -0,0 +1,70 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_trp.h
+ *  \brief  Internal transport header for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#ifndef IPL_TRP_H
+#define IPL_TRP_H
+
+#include <stdint.h>
+#include "ipl_cfg.h"
+#include "ipl_pb.h"
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+uint8_t Ipl_TrpIsValid(void);
+uint8_t Ipl_TrpHasCap(uint8_t cap);
+uint8_t Ipl_TrpMaxTelLen(void);
+uint8_t Ipl_TrpSetResetPin(uint8_t lowHigh);
+uint8_t Ipl_TrpSetErrBootPin(uint8_t lowHigh);
+#ifdef IPL_USE_TRANSPORT
+uint8_t Ipl_TrpSetPins(uint8_t resetLowHigh, uint8_t errBootLowHigh);
+#endif
+uint8_t Ipl_TrpInicRead(uint8_t lData, uint8_t* pData);
+uint8_t Ipl_TrpInicWrite(uint8_t lData, uint8_t* pData);
+void    Ipl_TrpSleep(uint16_t timeMs);
+#ifdef IPL_USE_SLEEPUS
+void    Ipl_TrpSleepUs(uint32_t timeUs);
+#endif
+#ifdef IPL_USE_INTPIN
+uint8_t Ipl_TrpGetIntPin(void);
+#endif
+#ifdef IPL_USE_INTPIN_EDGE
+uint8_t Ipl_TrpWaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs);
+#endif
+#ifdef IPL_USE_INICTRANSFER
+uint8_t Ipl_TrpInicTransfer(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs);
+#endif
+#ifdef IPL_USE_INICBATCH
+uint8_t Ipl_TrpInicTransferBatch(uint8_t num, Ipl_Telegram_t tel[]);
+#endif
+#ifdef IPL_INICDRIVER_OPENCLOSE
+uint8_t Ipl_TrpInicDriverOpen(void);
+uint8_t Ipl_TrpInicDriverClose(void);
+#endif
+
+#endif
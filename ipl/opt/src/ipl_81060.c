@@ -41,7 +41,6 @@
 uint8_t OS81060_ProgConfigString(uint32_t lData, uint8_t pData[])
 {
     uint8_t  res;
-    uint32_t loop;
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81060_ProgConfigString called");
     /* Get addresses and sizes from metadata */
     res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, STRINGTYPE_META);
@@ -52,7 +51,7 @@ uint8_t OS81060_ProgConfigString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Check if IPF fits to INIC */
-            res = Ipl_CheckChipId();
+            res = Ipl_CheckChipId(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 /* Write CS */
@@ -60,12 +59,12 @@ uint8_t OS81060_ProgConfigString(uint32_t lData, uint8_t pData[])
                 Ipl_IplData.Tel[1] = 0x00U;
                 Ipl_IplData.Tel[2] = 0x00U;
                 Ipl_IplData.Tel[3] = 0x20U;
-                for(loop=0U; loop<32U; loop++)
+                res = Ipl_CopyPData(&Ipl_IplData.Tel[4], Ipl_IpfData.StringOffset, 32U, lData, pData);
+                Ipl_IplData.TelLen = 36U;
+                if (IPL_RES_OK == res)
                 {
-                    Ipl_IplData.Tel[4U+loop] = Ipl_PData(loop+Ipl_IpfData.StringOffset, lData, pData);
+                    res = Ipl_ExecInicCmd();
                 }
-                Ipl_IplData.TelLen = 36U;
-                res = Ipl_ExecInicCmd();
             }
         }
     }
@@ -41,7 +41,7 @@
 uint8_t OS81110_ProgFirmware(uint32_t lData, uint8_t pData[])
 {
     uint8_t  res;
-    uint32_t loop, adr, startadr, stopadr;
+    uint32_t adr, startadr, stopadr;
 
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81110_ProgFirmware called");
     /* Get addresses and sizes from metadata */
@@ -53,7 +53,7 @@ uint8_t OS81110_ProgFirmware(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Check if IPF fits to INIC */
-            res = Ipl_CheckChipId();
+            res = Ipl_CheckChipId(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 /* Erase Enable */
@@ -98,16 +98,20 @@ uint8_t OS81110_ProgFirmware(uint32_t lData, uint8_t pData[])
                                     Ipl_IplData.Tel[1] = (adr >> 8U) & 0xFFU;
                                     Ipl_IplData.Tel[2] = adr & 0xFFU;
                                     Ipl_IplData.Tel[3] = 0x20U;
-                                    for(loop=0U; loop<32U; loop++)
+                                    res = Ipl_CopyPData(&Ipl_IplData.Tel[4], (Ipl_IpfData.StringOffset+adr)-startadr, 32U, lData, pData);
+                                    Ipl_IplData.TelLen = 36U;
+                                    if (IPL_RES_OK == res)
                                     {
-                                        Ipl_IplData.Tel[4U+loop] = Ipl_PData((loop+Ipl_IpfData.StringOffset+adr)-startadr, lData, pData);
+                                        res = Ipl_QueueInicCmd();
                                     }
-                                    Ipl_IplData.TelLen = 36U;
-                                    res = Ipl_ExecInicCmd();
                                     adr += 0x20U;
                                     Ipl_ProgressIndicator(adr-startadr, Ipl_IpfData.StringSize);
                                 }
                                 if (IPL_RES_OK == res)
+                                {
+                                    res = Ipl_FlushInicCmds();
+                                }
+                                if (IPL_RES_OK == res)
                                 {
                                     /* Select Flash Page 1 */
                                     Ipl_ClrTel();
@@ -126,16 +130,20 @@ uint8_t OS81110_ProgFirmware(uint32_t lData, uint8_t pData[])
                                             Ipl_IplData.Tel[1] = (adr >> 8U) & 0xFFU;
                                             Ipl_IplData.Tel[2] = adr & 0xFFU;
                                             Ipl_IplData.Tel[3] = 0x20U;
-                                            for(loop=0U; loop<32U; loop++)
+                                            res = Ipl_CopyPData(&Ipl_IplData.Tel[4], (Ipl_IpfData.StringOffset+adr)-startadr, 32U, lData, pData);
+                                            Ipl_IplData.TelLen = 36U;
+                                            if (IPL_RES_OK == res)
                                             {
-                                                Ipl_IplData.Tel[4U+loop] = Ipl_PData((loop+Ipl_IpfData.StringOffset+adr)-startadr, lData, pData);
+                                                res = Ipl_QueueInicCmd();
                                             }
-                                            Ipl_IplData.TelLen = 36U;
-                                            res = Ipl_ExecInicCmd();
                                             adr += 0x20U;
                                             Ipl_ProgressIndicator(adr-startadr, Ipl_IpfData.StringSize);
                                         }
                                         if (IPL_RES_OK == res)
+                                        {
+                                            res = Ipl_FlushInicCmds();
+                                        }
+                                        if (IPL_RES_OK == res)
                                         {
                                             /* Get CRC */
                                             Ipl_ClrTel();
@@ -170,7 +178,7 @@ uint8_t OS81110_ProgFirmware(uint32_t lData, uint8_t pData[])
 uint8_t OS81110_ProgConfigString(uint32_t lData, uint8_t pData[])
 {
     uint8_t  res;
-    uint32_t loop, page;
+    uint32_t page;
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81110_ProgConfigString called");
     /* Get addresses and sizes from metadata */
     res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, STRINGTYPE_META);
@@ -181,7 +189,7 @@ uint8_t OS81110_ProgConfigString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Check if IPF fits to INIC */
-            res = Ipl_CheckChipId();
+            res = Ipl_CheckChipId(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 /* Erase Enable */
@@ -214,12 +222,12 @@ uint8_t OS81110_ProgConfigString(uint32_t lData, uint8_t pData[])
                                 Ipl_IplData.Tel[1] = 0x00U;
                                 Ipl_IplData.Tel[2] = (uint8_t) page*32U;
                                 Ipl_IplData.Tel[3] = 0x20U;
-                                for(loop=0U; loop<32U; loop++)
+                                res = Ipl_CopyPData(&Ipl_IplData.Tel[4], Ipl_IpfData.StringOffset+(uint32_t) (page*32U), 32U, lData, pData);
+                                Ipl_IplData.TelLen = 36U;
+                                if (IPL_RES_OK == res)
                                 {
-                                    Ipl_IplData.Tel[4U+loop] = Ipl_PData(loop+Ipl_IpfData.StringOffset+(uint32_t) (page*32U), lData, pData);
+                                    res = Ipl_ExecInicCmd();
                                 }
-                                Ipl_IplData.TelLen = 36U;
-                                res = Ipl_ExecInicCmd();
                                 Ipl_ProgressIndicator((page*32U), Ipl_IpfData.StringSize);
                             }
                             if (IPL_RES_OK == res)
@@ -41,9 +41,15 @@ Ipl_IpfData_t Ipl_IpfData;
 /*------------------------------------------------------------------------------------------------*/
 
 static uint8_t Ipl_SetStdMetaProps(Ipl_IpfData_t *ipf, uint32_t pid, uint32_t pval, uint8_t ptype);
-static uint8_t Ipl_SetDefaultMetaProps(Ipl_IpfData_t *ipf);
 static uint8_t Ipl_CheckMetaPType(uint32_t pid, uint32_t pval, uint8_t ptype_act, uint8_t ptype_ref);
-static void    Ipl_TraceIpf(uint32_t nOfBytes, uint8_t pData[]);
+static void    Ipl_TraceIpf(const Ipl_IpfData_t *ipf, uint32_t nOfBytes, uint8_t pData[]);
+static const Ipl_IpfString_t* Ipl_FindIpfString(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
+static void    Ipl_CheckIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[]);
+static void    Ipl_StartIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint32_t key);
+static void    Ipl_WalkIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
+static void    Ipl_ClrIpfIndex(Ipl_IpfData_t *ipf);
+static uint8_t Ipl_ParseMeta(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint32_t offset);
+static uint32_t Ipl_HashIpfString(uint32_t lData, uint8_t pData[], uint32_t offset, uint32_t size);
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -53,11 +59,10 @@ static void    Ipl_TraceIpf(uint32_t nOfBytes, uint8_t pData[]);
 /*! \internal Parses the referred IPF data for the referred string. */
 uint8_t Ipl_ParseIpf(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType)
 {
-    uint32_t offset = 6U;
+    uint32_t offset = 0U;
     uint8_t  res    = IPL_RES_ERR_IPF_INVALID; /*! \internal Jira UN-373 */
-    uint32_t offset_s;
-    uint8_t  ptype;
-    uint32_t i, pi, pid, pval, plen;
+    const Ipl_IpfString_t *pString;
+    uint32_t hash;
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf called with %u byte IPF, StringType 0x%02X", lData, stringType);
     if (STRINGTYPE_META == stringType)
     {
@@ -68,111 +73,57 @@ uint8_t Ipl_ParseIpf(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_
     {
         if ((STRING_MIN_LEN <= lData) && (NULL != pData)) /*! \internal Jira UN-373 */
         {
-            ipf->ChipID = Ipl_PData(1U, lData, pData);
+            Ipl_CheckIpfIndex(ipf, lData, pData);
+            ipf->ChipID = ipf->Index.ChipID;
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf IPF ChipID 0x%02X", ipf->ChipID);
             res = IPL_RES_ERR_IPF_WRONGINIC;
-            if (Ipl_IplData.ChipID == ipf->ChipID)
+            if (ipf->ProgChipID == ipf->ChipID)
             {
-                Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf start with Offset %u", offset);
-                while ((offset + 9U) < lData)
+                pString = Ipl_FindIpfString(ipf, lData, pData, stringType);
+                if (NULL != pString)
                 {
-                    if (Ipl_PData(offset, lData, pData) == stringType)
-                    {
-                        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf StringType 0x%02X found at Offset %u", stringType, offset);
-                        break;
-                    }
-                    offset_s = offset;
-                    offset += ( ((uint32_t) Ipl_PData(offset_s + 6U, lData, pData) << 24U )
-                              + ((uint32_t) Ipl_PData(offset_s + 7U, lData, pData) << 16U )
-                              + ((uint32_t) Ipl_PData(offset_s + 8U, lData, pData) <<  8U )
-                              + ((uint32_t) Ipl_PData(offset_s + 9U, lData, pData) & 0xFFU) ) + 10U;
-                    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf current Offset %u", offset);
+                    offset = pString->Offset;
                 }
                 res = IPL_RES_ERR_IPF_WRONGSTRINGTYPE; /* Offset out of bounds */
                 Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf current Offset %u", offset);
-                if ((offset + 13U) < lData) /* +9U, 10U */
+                if ((NULL != pString) && ((offset + 13U) < lData)) /* +9U, 10U */
                 {
-                    res = IPL_RES_OK;
-                    if (Ipl_PData(offset, lData, pData) == stringType)
+                    if (Ipl_PData(offset, lData, pData) == stringType) /* Index still matches the data */
                     {
+                        res = IPL_RES_OK;
                         /* Image is fine and we can continue */
-                        Ipl_IpfData.StringType    = stringType;
-                        Ipl_IpfData.StringOffset  = offset + 10U; /* Points to first data byte */
-                        Ipl_IpfData.StringSize    = (uint32_t) Ipl_PData(offset + 6U, lData, pData) << 24U;
-                        Ipl_IpfData.StringSize   += (uint32_t) Ipl_PData(offset + 7U, lData, pData) << 16U;
-                        Ipl_IpfData.StringSize   += (uint32_t) Ipl_PData(offset + 8U, lData, pData) <<  8U;
-                        Ipl_IpfData.StringSize   += (uint32_t) Ipl_PData(offset + 9U, lData, pData)       ;
+                        ipf->StringType    = stringType;
+                        ipf->StringOffset  = offset + 10U; /* Points to first data byte */
+                        ipf->StringSize    = pString->Size;
                         switch (ipf->StringType)
                         {
                             case STRINGTYPE_FW:
-                                ipf->ProgAddr  = (uint32_t) Ipl_PData(offset + 2U, lData, pData) << 24U ;
-                                ipf->ProgAddr += (uint32_t) Ipl_PData(offset + 3U, lData, pData) << 16U ;
-                                ipf->ProgAddr += (uint32_t) Ipl_PData(offset + 4U, lData, pData) <<  8U ;
-                                ipf->ProgAddr += (uint32_t) Ipl_PData(offset + 5U, lData, pData)        ;
+                                ipf->ProgAddr  = pString->ProgAddr;
                                 Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf ProgAddr 0x%X", ipf->ProgAddr);
                                 break;
                             case STRINGTYPE_PS:
-                                ipf->ProgAddr = Ipl_IpfData.Meta.PatchsStdStartAddr;
+                                ipf->ProgAddr = ipf->Meta.PatchsStdStartAddr;
                                 Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf ProgAddr 0x%X", ipf->ProgAddr);
                                 break;
                             case STRINGTYPE_META:
-                                ipf->Meta.NumOfItems  = (uint32_t) Ipl_PData(offset + 10U, lData, pData) << 24U ;
-                                ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 11U, lData, pData) << 16U ;
-                                ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 12U, lData, pData) <<  8U ;
-                                ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 13U, lData, pData)        ;
-                                Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf %u Meta Items found", ipf->Meta.NumOfItems);
-                                if ((offset + 14U + (ipf->Meta.NumOfItems*12U)) < lData)
+                                hash = Ipl_HashIpfString(lData, pData, offset, pString->Size);
+                                if ((IPL_HIGH == ipf->MetaCache.Valid) && (lData == ipf->MetaCache.lData) &&
+                                    (ipf->ChipID == ipf->MetaCache.ChipID) && (hash == ipf->MetaCache.Hash))
                                 {
-                                    for (i=0U; i<ipf->Meta.NumOfItems; i++)
-                                    {
-                                        pid   = (uint32_t) Ipl_PData(offset + 14U + (i*12U)      , lData, pData) << 24U;
-                                        pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  1U, lData, pData) << 16U;
-                                        pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  2U, lData, pData) <<  8U;
-                                        pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  3U, lData, pData)       ;
-                                        ptype =            Ipl_PData(offset + 14U + (i*12U) +  4U, lData, pData)       ;
-                                        pval  = (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  8U, lData, pData) << 24U;
-                                        pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  9U, lData, pData) << 16U;
-                                        pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 10U, lData, pData) <<  8U;
-                                        pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 11U, lData, pData)       ;
-
-                                        res = Ipl_SetStdMetaProps(ipf, pid, pval, ptype);
-                                        /* Handle Tool Type String */
-                                        if (METAID_TOOLTYPE == pid)
-                                        {
-                                            if (METATYPE_STRING == ptype)
-                                            {
-                                                plen  = (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 5U, lData, pData)  << 16U ;
-                                                plen += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 6U, lData, pData)  <<  8U ;
-                                                plen += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 7U, lData, pData)         ;
-                                                if ((TOOL_MAX_TYPELEN - 1U) < plen)
-                                                {
-                                                    plen = TOOL_MAX_TYPELEN - 1U;
-                                                }
-                                                if ((offset + 10U + pval + plen) <= lData)
-                                                {
-                                                    for (pi=0U; pi<plen; pi++)
-                                                    {
-                                                        ipf->Meta.ToolType[pi] = (char) Ipl_PData(offset + 10U + pval + pi,
-                                                                                                  lData, pData);
-                                                    }
-                                                    ipf->Meta.ToolType[pi + 1U] = '\0';
-                                                    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf MetaID 0x%08X (ToolType) = '%s'",
-                                                              pid, ipf->Meta.ToolType);
-                                                }
-                                                else
-                                                {
-                                                    /* res = IPL_RES_ERR_IPF_WRONGSTRINGTYPE; */ /* No error, just ignore it */
-                                                    Ipl_Trace(IPL_TRACETAG_ERR,
-                                                              "Ipl_ParseIpf MetaID 0x%08X (ToolType) out of bounds", pid);
-                                                }
-                                            }
-                                        }
-                                    }
+                                    ipf->Meta = ipf->MetaCache.Meta;
+                                    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf Meta data taken from cache, Hash 0x%08X", hash);
                                 }
                                 else
                                 {
-                                    res = IPL_RES_ERR_IPF_WRONGSTRINGTYPE;
-                                    Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_ParseIpf Meta data out of bounds");
+                                    res = Ipl_ParseMeta(ipf, lData, pData, offset);
+                                    if (IPL_RES_OK == res)
+                                    {
+                                        ipf->MetaCache.Valid  = IPL_HIGH;
+                                        ipf->MetaCache.ChipID = ipf->ChipID;
+                                        ipf->MetaCache.lData  = lData;
+                                        ipf->MetaCache.Hash   = hash;
+                                        ipf->MetaCache.Meta   = ipf->Meta;
+                                    }
                                 }
                                 break;
                             case STRINGTYPE_CONFIG:
@@ -188,7 +139,7 @@ uint8_t Ipl_ParseIpf(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_
                             if (ipf->StringSize < lData)
                             {
                                 Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf StringSize %u", ipf->StringSize);
-                                Ipl_TraceIpf(ipf->StringSize, pData);
+                                Ipl_TraceIpf(ipf, ipf->StringSize, pData);
                             }
                             else
                             {
@@ -229,6 +180,89 @@ uint8_t Ipl_ParseIpf(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_
 }
 
 
+/*! \internal Decodes all Meta items of the string at the referred offset. */
+static uint8_t Ipl_ParseMeta(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint32_t offset)
+{
+    uint8_t  res = IPL_RES_OK;
+    uint8_t  ptype;
+    uint32_t i, pi, pid, pval, plen;
+    ipf->Meta.NumOfItems  = (uint32_t) Ipl_PData(offset + 10U, lData, pData) << 24U ;
+    ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 11U, lData, pData) << 16U ;
+    ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 12U, lData, pData) <<  8U ;
+    ipf->Meta.NumOfItems += (uint32_t) Ipl_PData(offset + 13U, lData, pData)        ;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf %u Meta Items found", ipf->Meta.NumOfItems);
+    if ((offset + 14U + (ipf->Meta.NumOfItems*12U)) < lData)
+    {
+        for (i=0U; i<ipf->Meta.NumOfItems; i++)
+        {
+            pid   = (uint32_t) Ipl_PData(offset + 14U + (i*12U)      , lData, pData) << 24U;
+            pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  1U, lData, pData) << 16U;
+            pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  2U, lData, pData) <<  8U;
+            pid  += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  3U, lData, pData)       ;
+            ptype =            Ipl_PData(offset + 14U + (i*12U) +  4U, lData, pData)       ;
+            pval  = (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  8U, lData, pData) << 24U;
+            pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) +  9U, lData, pData) << 16U;
+            pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 10U, lData, pData) <<  8U;
+            pval += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 11U, lData, pData)       ;
+
+            res = Ipl_SetStdMetaProps(ipf, pid, pval, ptype);
+            /* Handle Tool Type String */
+            if (METAID_TOOLTYPE == pid)
+            {
+                if (METATYPE_STRING == ptype)
+                {
+                    plen  = (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 5U, lData, pData)  << 16U ;
+                    plen += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 6U, lData, pData)  <<  8U ;
+                    plen += (uint32_t) Ipl_PData(offset + 14U + (i*12U) + 7U, lData, pData)         ;
+                    if ((TOOL_MAX_TYPELEN - 1U) < plen)
+                    {
+                        plen = TOOL_MAX_TYPELEN - 1U;
+                    }
+                    if ((offset + 10U + pval + plen) <= lData)
+                    {
+                        for (pi=0U; pi<plen; pi++)
+                        {
+                            ipf->Meta.ToolType[pi] = (char) Ipl_PData(offset + 10U + pval + pi,
+                                                                      lData, pData);
+                        }
+                        ipf->Meta.ToolType[pi + 1U] = '\0';
+                        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf MetaID 0x%08X (ToolType) = '%s'",
+                                  pid, ipf->Meta.ToolType);
+                    }
+                    else
+                    {
+                        /* res = IPL_RES_ERR_IPF_WRONGSTRINGTYPE; */ /* No error, just ignore it */
+                        Ipl_Trace(IPL_TRACETAG_ERR,
+                                  "Ipl_ParseIpf MetaID 0x%08X (ToolType) out of bounds", pid);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        res = IPL_RES_ERR_IPF_WRONGSTRINGTYPE;
+        Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_ParseIpf Meta data out of bounds");
+    }
+
+    return res;
+}
+
+
+/*! \internal Returns the FNV-1a hash of the referred string (header and data), used to identify cached Meta data. */
+static uint32_t Ipl_HashIpfString(uint32_t lData, uint8_t pData[], uint32_t offset, uint32_t size)
+{
+    uint32_t i;
+    uint32_t hash = 0x811C9DC5U; /* FNV offset basis */
+    for (i=offset; (i<(offset + 10U + size)) && (i<lData); i++)
+    {
+        hash ^= (uint32_t) Ipl_PData(i, lData, pData);
+        hash *= 0x01000193U; /* FNV prime */
+    }
+    return hash;
+}
+
+
 /*! \internal Checks all the standard Meta properies and sets them. */
 static uint8_t Ipl_SetStdMetaProps(Ipl_IpfData_t *ipf, uint32_t pid, uint32_t pval, uint8_t ptype)
 {
@@ -529,8 +563,9 @@ static uint8_t Ipl_SetStdMetaProps(Ipl_IpfData_t *ipf, uint32_t pid, uint32_t pv
 }
 
 
-/*! \internal In case the IPF data does not contain Meta information the default values are set. */
-static uint8_t Ipl_SetDefaultMetaProps(Ipl_IpfData_t *ipf)
+/*! \internal In case the IPF data does not contain Meta information the default values are set.
+ *  Also provides the memory layout if no IPF data is given at all. */
+uint8_t Ipl_SetDefaultMetaProps(Ipl_IpfData_t *ipf)
 {
     uint8_t res = IPL_RES_OK;
 	Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_SetDefaultMetaProps called with ChipID 0x%02X", ipf->ChipID);
@@ -716,19 +751,222 @@ static uint8_t Ipl_SetDefaultMetaProps(Ipl_IpfData_t *ipf)
 }
 
 
-/*! \internal Sets all IPF properties to the default value. */
-void Ipl_ClrIpfData(Ipl_IpfData_t *ipf)
+/*! \internal Sets all IPF properties to the default value, the IPF data has to be for chipID. */
+void Ipl_ClrIpfData(Ipl_IpfData_t *ipf, uint8_t chipID)
 {
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ClrIpfData");
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ClrIpfData called with ChipID 0x%02X", chipID);
+    ipf->ProgChipID                        = chipID;
     ipf->ProgAddr                          = DEFAULTVAL_UINT32;
     ipf->StringSize                        = DEFAULTVAL_UINT32;
     ipf->StringOffset                      = DEFAULTVAL_UINT32;
     ipf->StringType                        = DEFAULTVAL_UINT8;
     ipf->ChipID                            = DEFAULTVAL_UINT8;
     Ipl_ClrMetaData(ipf);
+    Ipl_ClrIpfIndex(ipf); /* Content of the IPF buffer may change from here on */
+}
+
+
+/*! \internal Returns the first string of the referred type, NULL if the IPF does not contain it. */
+static const Ipl_IpfString_t* Ipl_FindIpfString(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType)
+{
+    const Ipl_IpfString_t *pString = NULL;
+    if ((STRINGTYPE_MAX >= stringType) && (DEFAULTVAL_UINT8 == ipf->Index.First[stringType]) &&
+        (IPL_HIGH != ipf->Index.Complete))
+    {
+        Ipl_WalkIpfIndex(ipf, lData, pData, stringType); /* Streaming only, the index is built up to the type looked for */
+    }
+    if ((STRINGTYPE_MAX >= stringType) && (DEFAULTVAL_UINT8 != ipf->Index.First[stringType]))
+    {
+        pString = &ipf->Index.String[ipf->Index.First[stringType]];
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ParseIpf StringType 0x%02X found at Offset %u", stringType, pString->Offset);
+    }
+    return pString;
+}
+
+
+/*! \internal Rebuilds the string index unless it was built for the same IPF data and the IPF header still matches. */
+static void Ipl_CheckIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[])
+{
+    uint32_t key = 0U;
+#ifndef IPL_USE_STREAMING
+    key = Ipl_HashIpfString(lData, pData, 0U, 6U); /* IPF header and first string header, a stream is not read back */
+#endif
+    if ((IPL_HIGH != ipf->Index.Valid) || (pData != ipf->Index.pData) || (lData != ipf->Index.lData) ||
+        (key != ipf->Index.Key))
+    {
+        Ipl_StartIpfIndex(ipf, lData, pData, key);
+#ifndef IPL_USE_STREAMING
+        Ipl_WalkIpfIndex(ipf, lData, pData, DEFAULTVAL_UINT8); /* All string headers in one pass */
+#endif
+    }
 }
 
 
+/*! \internal Starts a new string index for the referred IPF data. */
+static void Ipl_StartIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint32_t key)
+{
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_StartIpfIndex called with %u byte IPF, Key 0x%08X", lData, key);
+    Ipl_ClrIpfIndex(ipf);
+    ipf->Index.ChipID = Ipl_PData(1U, lData, pData);
+    ipf->Index.Next   = 6U;
+    ipf->Index.pData  = pData;
+    ipf->Index.lData  = lData;
+    ipf->Index.Key    = key;
+    ipf->Index.Valid  = IPL_HIGH;
+}
+
+
+/*! \internal Records string headers from Index.Next on, until the referred type is found or up to the end. */
+static void Ipl_WalkIpfIndex(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType)
+{
+    uint32_t offset = ipf->Index.Next;
+    uint32_t size;
+    uint8_t  type = STRINGTYPE_MAX + 1U;
+    Ipl_IpfString_t *pString;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WalkIpfIndex called with Offset %u, StringType 0x%02X", offset, stringType);
+    ipf->Index.Complete = IPL_HIGH;
+    while ((offset + 9U) < lData)
+    {
+        type  =            Ipl_PData(offset,      lData, pData);
+        size  = (uint32_t) Ipl_PData(offset + 6U, lData, pData) << 24U;
+        size += (uint32_t) Ipl_PData(offset + 7U, lData, pData) << 16U;
+        size += (uint32_t) Ipl_PData(offset + 8U, lData, pData) <<  8U;
+        size += (uint32_t) Ipl_PData(offset + 9U, lData, pData)       ;
+        if ((0U == type) || (STRINGTYPE_MAX < type))
+        {
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WalkIpfIndex StringType 0x%02X at Offset %u skipped", type, offset);
+        }
+        else if (STRING_MAX_INDEX > ipf->Index.NumOfStrings)
+        {
+            pString            = &ipf->Index.String[ipf->Index.NumOfStrings];
+            pString->Type      = type;
+            pString->Offset    = offset;
+            pString->Size      = size;
+            pString->ProgAddr  = (uint32_t) Ipl_PData(offset + 2U, lData, pData) << 24U;
+            pString->ProgAddr += (uint32_t) Ipl_PData(offset + 3U, lData, pData) << 16U;
+            pString->ProgAddr += (uint32_t) Ipl_PData(offset + 4U, lData, pData) <<  8U;
+            pString->ProgAddr += (uint32_t) Ipl_PData(offset + 5U, lData, pData)       ;
+            if (DEFAULTVAL_UINT8 == ipf->Index.First[type])
+            {
+                ipf->Index.First[type] = ipf->Index.NumOfStrings;
+            }
+            ipf->Index.NumOfStrings++;
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WalkIpfIndex StringType 0x%02X at Offset %u, Size %u", type, offset, size);
+        }
+        else
+        {
+            Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_WalkIpfIndex StringType 0x%02X at Offset %u not indexed, more than %u strings", type, offset, STRING_MAX_INDEX);
+        }
+        if ((lData - offset) < (size + 10U))
+        {
+            break; /* Last string, also avoids an overflow of the offset */
+        }
+        offset += size + 10U;
+        if ((STRINGTYPE_MAX >= stringType) && (stringType == type))
+        {
+            ipf->Index.Complete = IPL_LOW; /* Continue here when another type is looked for */
+            break;
+        }
+    }
+    ipf->Index.Next = offset;
+}
+
+
+/*! \internal Invalidates the string index. */
+static void Ipl_ClrIpfIndex(Ipl_IpfData_t *ipf)
+{
+    uint8_t i;
+    ipf->Index.pData        = NULL;
+    ipf->Index.lData        = 0U;
+    ipf->Index.Key          = 0U;
+    ipf->Index.Valid        = IPL_LOW;
+    ipf->Index.Complete     = IPL_LOW;
+    ipf->Index.ChipID       = DEFAULTVAL_UINT8;
+    ipf->Index.Next         = 0U;
+    ipf->Index.NumOfStrings = 0U;
+    for (i=0U; i<=STRINGTYPE_MAX; i++)
+    {
+        ipf->Index.First[i] = DEFAULTVAL_UINT8;
+    }
+#ifdef IPL_USE_HOSTCRC
+    ipf->Index.Crc.Valid = IPL_LOW;
+#endif
+}
+
+
+#ifdef IPL_USE_HOSTCRC
+/*! \internal Returns the CRCs of the referred string, they are calculated once per indexed IPF data. NULL if the data is not available. */
+const Ipl_IpfCrc_t* Ipl_GetIpfCrc(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType)
+{
+    Ipl_IpfCrc_t *pCrc = &ipf->Index.Crc;
+    const Ipl_IpfString_t *pString;
+    uint32_t done = 0U;
+    uint32_t pageSize, pageMark, bodyEnd, next, span;
+    uint8_t* pSrc;
+    Ipl_CheckIpfIndex(ipf, lData, pData);
+    if ((IPL_HIGH != pCrc->Valid) || (stringType != pCrc->StringType))
+    {
+        pCrc->Valid = IPL_LOW;
+        pString     = Ipl_FindIpfString(ipf, lData, pData, stringType);
+        if ((NULL != pString) && (pString->Size <= lData) && ((pString->Offset + 10U) <= (lData - pString->Size)))
+        {
+            pCrc->StringType = stringType;
+            pCrc->Crc        = 0U; /* Start value after CMD_CLEARCRC */
+            pCrc->BodyCrc    = 0U;
+            pCrc->NumOfPages = 0U;
+            bodyEnd  = (2U < pString->Size) ? (pString->Size - 2U) : 0U; /* Start of the appended CRC */
+            pageSize = ipf->Meta.ChipPrgMemPageSize;
+            pageMark = pString->Size; /* No page checkpoints */
+            if ((STRINGTYPE_FW == stringType) && (0U != pageSize) && (DEFAULTVAL_UINT32 != pageSize))
+            {
+                pageMark = pageSize - (pString->ProgAddr % pageSize);
+            }
+            while (done < pString->Size)
+            {
+                next = pString->Size;
+                if (pageMark < next)
+                {
+                    next = pageMark;
+                }
+                if ((done < bodyEnd) && (bodyEnd < next))
+                {
+                    next = bodyEnd;
+                }
+                span = next - done;
+                pSrc = Ipl_PDataSpan(pString->Offset + 10U + done, &span, lData, pData);
+                if (NULL == pSrc)
+                {
+                    break;
+                }
+                pCrc->Crc = Ipl_CalcCrc(pCrc->Crc, pSrc, span);
+                done += span;
+                if (done == bodyEnd)
+                {
+                    pCrc->BodyCrc = pCrc->Crc;
+                }
+                if ((done == pageMark) && (done < pString->Size))
+                {
+                    if (STRING_MAX_PAGECRCS > pCrc->NumOfPages)
+                    {
+                        pCrc->PageCrc[pCrc->NumOfPages] = pCrc->Crc;
+                        pCrc->NumOfPages++;
+                    }
+                    pageMark += pageSize;
+                }
+            }
+            if (done == pString->Size)
+            {
+                pCrc->Valid = IPL_HIGH;
+                Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_GetIpfCrc StringType 0x%02X, CRC 0x%04X, %u Pages",
+                          stringType, pCrc->Crc, pCrc->NumOfPages);
+            }
+        }
+    }
+    return (IPL_HIGH == pCrc->Valid) ? pCrc : NULL;
+}
+#endif
+
+
 /*! \internal Sets all Meta properties to the default value. */
 void Ipl_ClrMetaData(Ipl_IpfData_t *ipf)
 {
@@ -800,10 +1038,10 @@ static uint8_t Ipl_CheckMetaPType(uint32_t pid, uint32_t pval, uint8_t ptype_act
 /* TRACE LOGGING                                                                                  */
 /*------------------------------------------------------------------------------------------------*/
 
-/*! \internal Traces out the IPF data. */
-static void Ipl_TraceIpf(uint32_t nOfBytes, uint8_t pData[])
+/*! \internal Traces out the IPF data of the string parsed last. */
+static void Ipl_TraceIpf(const Ipl_IpfData_t *ipf, uint32_t nOfBytes, uint8_t pData[])
 {
-#ifdef IPL_TRACETAG_IPF
+#if defined IPL_TRACETAG_IPF && !defined IPL_USE_STREAMING /* A stream cannot be read ahead of programming */
     char     line [TRACELINE_MAXLEN];
     uint32_t len, i;
     uint32_t data   = 0U;
@@ -823,8 +1061,8 @@ static void Ipl_TraceIpf(uint32_t nOfBytes, uint8_t pData[])
         /* Write Ipf line */
         for (i=0U; i<len; i++)
         {
-            line[0U+(i*3U)] = Ipl_Bcd2Char(Ipl_PData(Ipl_IpfData.StringOffset+i+data, nOfBytes, pData), IPL_HIGH);
-            line[1U+(i*3U)] = Ipl_Bcd2Char(Ipl_PData(Ipl_IpfData.StringOffset+i+data, nOfBytes, pData), IPL_LOW);
+            line[0U+(i*3U)] = Ipl_Bcd2Char(Ipl_PData(ipf->StringOffset+i+data, nOfBytes, pData), IPL_HIGH);
+            line[1U+(i*3U)] = Ipl_Bcd2Char(Ipl_PData(ipf->StringOffset+i+data, nOfBytes, pData), IPL_LOW);
             line[2U+(i*3U)] = ' ';
         }
         line[0U+(len*3U)] = '\0';
@@ -26,10 +26,14 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 #include "ipl_cfg.h"
 #include "ipl.h"
 #include "ipl_pb.h"
 #include "ipf.h"
+#include "ipl_tim.h"
+#include "ipl_trp.h"
+#include "ipl_ipz.h"
 #include "ipl_81118.h"
 #include "ipl_81119.h"
 #include "ipl_81210.h"
@@ -61,6 +65,11 @@
 /*------------------------------------------------------------------------------------------------*/
 
 #define IPL_RES_CC_OK 0xFFU /* Completion code is fine */
+#ifdef IPL_USE_STARTUP_PROBING
+#define IPL_STARTUP_PROBE IPL_HIGH /* Bootloader is probed instead of sleeping the bootup time */
+#else
+#define IPL_STARTUP_PROBE IPL_LOW
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -69,17 +78,57 @@
 
 static uint8_t Ipl_CheckConnectedInic(void);
 static uint8_t Ipl_Bcd2Byte(uint8_t bcd);
-static uint8_t Ipl_ReadFirmwareVersion(void);
 static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
 #ifdef IPL_CHK_IPF_JOBS
 static uint8_t Ipl_CheckIpfOnly(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData[], uint8_t stringType);
 #endif
-static uint8_t Ipl_StartupInic(uint8_t chipMode);
-static uint8_t Ipl_WaitForResponse(void);
+static uint8_t Ipl_StartupInic(uint8_t chipMode, uint8_t probe);
+static uint8_t Ipl_ProbeBootloader(uint32_t timeout);
+static uint8_t Ipl_SetProgStartTel(void);
+static uint8_t Ipl_SetReadFwVerTel(void);
+static uint8_t Ipl_WaitForResponse(uint8_t cmd);
+static uint8_t Ipl_ReadResponse(uint8_t rxlen);
+static uint8_t Ipl_EvalResponse(uint8_t cmd, uint8_t rxlen, uint8_t rw);
+static uint8_t Ipl_GetRxLen(uint8_t cmd);
+static uint8_t Ipl_GetExtDataLen(void);
+static uint32_t Ipl_GetWaitTime(uint8_t cmd);
+#ifdef IPL_USE_INICTRANSFER
+static uint8_t Ipl_TransferInicCmd(uint8_t cmd);
+#endif
+#ifdef IPL_USE_INICTRANSFER
+static uint8_t Ipl_IsDelayOnly(uint8_t cmd);
+#endif
+#ifdef IPL_USE_INICBATCH
+static uint8_t Ipl_IsBatchable(uint8_t cmd);
+static uint8_t Ipl_PrepareBatch(Ipl_Telegram_t tel[], uint8_t num);
+static uint8_t Ipl_EvalBatchTel(const Ipl_Telegram_t* pTel);
+#endif
+#ifdef IPL_USE_ERASE_POLLING
+static uint8_t Ipl_WaitForErase(uint8_t cmd, uint32_t timeout);
+#endif
+static uint32_t Ipl_Delay(uint32_t timeUs);
+#if IPL_DATACHUNK_SIZE > 0
+static void    Ipl_LoadDataChunk(uint32_t index);
+static uint8_t* Ipl_RequestDataChunk(uint8_t dest[]);
+#ifdef IPL_USE_CHUNK_PREFETCH
+static void    Ipl_HintDataChunk(void);
+#endif
+#endif
+#ifdef IPL_CHUNKCACHE_SLOTS
+static uint8_t Ipl_FindChunkSlot(uint32_t offset);
+static uint8_t Ipl_GetLruChunkSlot(void);
+static void    Ipl_ClrChunkCache(void);
+#endif
 static void    Ipl_TraceCfg(void);
 static void    Ipl_TraceTel(uint8_t direction);
 #ifdef IPL_USE_INTPIN
-static uint8_t Ipl_WaitForInt(uint16_t timeout);
+static uint8_t Ipl_WaitForInt(uint32_t timeout);
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+static uint32_t Ipl_PollForCompletion(uint8_t cmd, uint32_t timeout);
+static void     Ipl_ClrCmdStat(void);
+static void     Ipl_UpdateCmdStat(uint8_t cmd, uint32_t time, uint8_t done);
+static void     Ipl_TraceCmdStat(void);
 #endif
 
 
@@ -104,7 +153,7 @@ uint8_t Ipl_EnterProgMode(uint8_t chipID)
     Ipl_IplData.ChipID = chipID;
 
 #ifdef IPL_INICDRIVER_OPENCLOSE
-    cc = Ipl_InicDriverOpen();
+    cc = Ipl_TrpInicDriverOpen();
 #endif
     Ipl_Trace(IPL_TRACETAG_INFO, "INIC Programming Library %s", VERSIONTAG);
     Ipl_Trace(IPL_TRACETAG_INFO, "For support contact http://www.microchip.com/support");
@@ -117,40 +166,31 @@ uint8_t Ipl_EnterProgMode(uint8_t chipID)
 #endif
     Ipl_TraceCfg();
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_EnterProgMode called with ChipID 0x%02X", chipID);
+    if (IPL_LOW == Ipl_TrpIsValid())
+    {
+        cc  = 1U;
+        res = IPL_RES_ERR_INVALID_TRANSPORT;
+    }
     Ipl_InicData.TestMemCleared = INIC_TESTMEM_UNCLEARED;
-    Ipl_ClrIpfData(&Ipl_IpfData);
+    Ipl_ClrIpfData(&Ipl_IpfData, chipID);
+#ifdef IPL_CHUNKCACHE_SLOTS
+    Ipl_ClrChunkCache();
+    Ipl_IplData.ChunkHits   = 0U;
+    Ipl_IplData.ChunkMisses = 0U;
+#endif
+    Ipl_LoadTimingProfile(chipID);
+#ifdef IPL_USE_COMPLETION_POLLING
+    Ipl_ClrCmdStat();
+#endif
+#ifdef IPL_USE_INICBATCH
+    Ipl_IplData.BatchLen = 0U;
+#endif
     if (0U == cc)
     {
-        res = Ipl_StartupInic(INIC_MODE_BOOT);
+        res = Ipl_StartupInic(INIC_MODE_BOOT, IPL_STARTUP_PROBE);
         if (IPL_RES_OK == res)
         {
-            Ipl_ClrTel();
-            Ipl_IplData.Tel[0] = CMD_PROGSTART;
-            switch (chipID)
-            {
-                case IPL_CHIP_OS81118:
-                case IPL_CHIP_OS81119:
-                case IPL_CHIP_OS81050:
-                case IPL_CHIP_OS81060:
-                case IPL_CHIP_OS81082:
-                case IPL_CHIP_OS81092:
-                case IPL_CHIP_OS81110:
-                    Ipl_IplData.TelLen = CMD_PROGSTART_TXLEN;
-                    break;
-                case IPL_CHIP_OS81210:
-                case IPL_CHIP_OS81212:
-                case IPL_CHIP_OS81214:
-                case IPL_CHIP_OS81216:
-                    Ipl_IplData.Tel[4] = 0x28U;
-                    Ipl_IplData.Tel[5] = 0x1BU;
-                    Ipl_IplData.Tel[6] = 0x6BU;
-                    Ipl_IplData.Tel[7] = 0x95U;
-                    Ipl_IplData.TelLen = 8U;
-                    break;
-                default:
-                    res = IPL_RES_ERR_NOT_SUPPORTED;
-                    break;
-             }
+             res = Ipl_SetProgStartTel();
              if (IPL_RES_OK == res) /*! \internal Jira UN-369, UN-370 */
              {
                  res = Ipl_ExecInicCmd();
@@ -173,12 +213,19 @@ uint8_t Ipl_LeaveProgMode(void)
 {
     uint8_t res;
     uint8_t cc;
-    res = Ipl_StartupInic(INIC_MODE_NORMAL);
+#ifdef IPL_USE_COMPLETION_POLLING
+    Ipl_TraceCmdStat();
+#endif
+#ifdef IPL_CHUNKCACHE_SLOTS
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_LeaveProgMode chunk cache hits %u, misses %u",
+              Ipl_IplData.ChunkHits, Ipl_IplData.ChunkMisses);
+#endif
+    res = Ipl_StartupInic(INIC_MODE_NORMAL, IPL_LOW);
 	Ipl_Trace(Ipl_TraceTag(res), "Ipl_LeaveProgMode returned 0x%02X", res);
 #ifdef IPL_INICDRIVER_OPENCLOSE
     if (IPL_RES_OK == res)
     {
-        cc = Ipl_InicDriverClose();
+        cc = Ipl_TrpInicDriverClose();
         if (0U != cc)
         {
             res = IPL_RES_ERR_HW_INIC_COM;
@@ -195,6 +242,9 @@ uint8_t Ipl_Prog(uint8_t job, uint32_t lData, uint8_t* pData)
     /*! \internal Jira UN-371, UN-372 fixed by new design */
     uint8_t res = IPL_RES_ERR_NOT_SUPPORTED;
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_Prog called with Job 0x%02X", job);
+#if IPL_DATACHUNK_SIZE > 0
+    Ipl_IplData.ChunkErr = IPL_LOW;
+#endif
     switch (job)
     {
 #ifdef IPL_TRACETAG_DUMP
@@ -228,6 +278,9 @@ uint8_t Ipl_Prog(uint8_t job, uint32_t lData, uint8_t* pData)
         case IPL_JOB_READ_FIRMWARE_VER:
             res = Ipl_ReadFirmwareVersion(); /* No IPF data needed */
             break;
+        case IPL_JOB_CALIBRATE_TIMING:
+            res = Ipl_CalibrateTiming(); /* No IPF data needed */
+            break;
         default:
 #ifdef IPL_USE_OS81118
             if (IPL_CHIP_OS81118 == Ipl_IplData.ChipID)
@@ -741,6 +794,12 @@ uint8_t Ipl_Prog(uint8_t job, uint32_t lData, uint8_t* pData)
 #endif
             break;
     }
+#if IPL_DATACHUNK_SIZE > 0
+    if ((IPL_RES_OK == res) && (IPL_HIGH == Ipl_IplData.ChunkErr))
+    {
+        res = IPL_RES_ERR_INVALID_DATACHUNK;
+    }
+#endif
     Ipl_ExportChipInfo();
     Ipl_Trace(Ipl_TraceTag(res), "Ipl_Prog returned 0x%02X", res);
     return res;
@@ -748,7 +807,111 @@ uint8_t Ipl_Prog(uint8_t job, uint32_t lData, uint8_t* pData)
 
 
 /*! \internal Reads the firmware version from INIC. INIC needs to be in programming mode. */
-static uint8_t Ipl_ReadFirmwareVersion(void)
+uint8_t Ipl_ReadFirmwareVersion(void)
+{
+    uint8_t res = Ipl_SetReadFwVerTel();
+    if (IPL_RES_OK == res)
+    {
+        res = Ipl_ExecInicCmd();
+    }
+    if (IPL_RES_OK == res)
+    {
+        res = Ipl_CheckConnectedInic();
+    }
+    if (IPL_RES_OK == res)
+    {
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ReadFirmwareVersion returned 0x%02X - ChipID: 0x%2X - V%u.%u.%u-%u", res, Ipl_InicData.ChipID,
+                Ipl_InicData.FwMajorVersion, Ipl_InicData.FwMinorVersion, Ipl_InicData.FwReleaseVersion, Ipl_InicData.FwBuildVersion);
+    }
+    else
+    {
+        Ipl_InicData.FwVersionValid   = VERSION_INVALID;
+        Ipl_InicData.ChipID           = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
+        Ipl_InicData.FwMajorVersion   = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
+        Ipl_InicData.FwMinorVersion   = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
+        Ipl_InicData.FwReleaseVersion = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
+        Ipl_InicData.FwBuildVersion   = DEFAULTVAL_UINT32; /*! \internal Jira UN-376 */
+        Ipl_InicData.FwCrc            = DEFAULTVAL_UINT16; /*! \internal Jira UN-376 */
+        Ipl_Trace(Ipl_TraceTag(res), "Ipl_ReadFirmwareVersion returned 0x%02X", res);
+    }
+    return res;
+}
+
+
+/*! \internal Restarts INIC in programming mode and measures the bootup time and the response times of
+ *  CMD_PROGSTART and of reading the firmware version. */
+uint8_t Ipl_MeasureStartup(uint32_t* pBootTime, uint32_t* pRespTime)
+{
+    uint32_t time = 0U;
+    uint8_t  res  = Ipl_StartupInic(INIC_MODE_BOOT, IPL_HIGH);
+    if (IPL_RES_OK == res)
+    {
+        *pBootTime = Ipl_IplData.BootTime;
+        res = Ipl_SetProgStartTel();
+    }
+    if (IPL_RES_OK == res)
+    {
+        res = Ipl_MeasureInicCmd(&time);
+    }
+    if (IPL_RES_OK == res)
+    {
+        *pRespTime = time;
+        res = Ipl_SetReadFwVerTel();
+    }
+    if (IPL_RES_OK == res)
+    {
+        res = Ipl_MeasureInicCmd(&time);
+    }
+    if (IPL_RES_OK == res)
+    {
+        if (time > *pRespTime)
+        {
+            *pRespTime = time;
+        }
+        res = Ipl_CheckConnectedInic();
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_MeasureStartup returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Prepares the telegram that sets INIC in programming mode. */
+static uint8_t Ipl_SetProgStartTel(void)
+{
+    uint8_t res = IPL_RES_OK;
+    Ipl_ClrTel();
+    Ipl_IplData.Tel[0] = CMD_PROGSTART;
+    switch (Ipl_IplData.ChipID)
+    {
+        case IPL_CHIP_OS81118:
+        case IPL_CHIP_OS81119:
+        case IPL_CHIP_OS81050:
+        case IPL_CHIP_OS81060:
+        case IPL_CHIP_OS81082:
+        case IPL_CHIP_OS81092:
+        case IPL_CHIP_OS81110:
+            Ipl_IplData.TelLen = CMD_PROGSTART_TXLEN;
+            break;
+        case IPL_CHIP_OS81210:
+        case IPL_CHIP_OS81212:
+        case IPL_CHIP_OS81214:
+        case IPL_CHIP_OS81216:
+            Ipl_IplData.Tel[4] = 0x28U;
+            Ipl_IplData.Tel[5] = 0x1BU;
+            Ipl_IplData.Tel[6] = 0x6BU;
+            Ipl_IplData.Tel[7] = 0x95U;
+            Ipl_IplData.TelLen = 8U;
+            break;
+        default:
+            res = IPL_RES_ERR_NOT_SUPPORTED;
+            break;
+    }
+    return res;
+}
+
+
+/*! \internal Prepares the telegram that reads the firmware version. */
+static uint8_t Ipl_SetReadFwVerTel(void)
 {
     uint8_t res = IPL_RES_OK;
     Ipl_ClrTel();
@@ -777,30 +940,6 @@ static uint8_t Ipl_ReadFirmwareVersion(void)
             res = IPL_RES_ERR_WRONG_INIC;
             break;
     }
-    if (IPL_RES_OK == res)
-    {
-        res = Ipl_ExecInicCmd();
-    }
-    if (IPL_RES_OK == res)
-    {
-        res = Ipl_CheckConnectedInic();
-    }
-    if (IPL_RES_OK == res)
-    {
-        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ReadFirmwareVersion returned 0x%02X - ChipID: 0x%2X - V%u.%u.%u-%u", res, Ipl_InicData.ChipID,
-                Ipl_InicData.FwMajorVersion, Ipl_InicData.FwMinorVersion, Ipl_InicData.FwReleaseVersion, Ipl_InicData.FwBuildVersion);
-    }
-    else
-    {
-        Ipl_InicData.FwVersionValid   = VERSION_INVALID;
-        Ipl_InicData.ChipID           = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
-        Ipl_InicData.FwMajorVersion   = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
-        Ipl_InicData.FwMinorVersion   = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
-        Ipl_InicData.FwReleaseVersion = DEFAULTVAL_UINT8;  /*! \internal Jira UN-376 */
-        Ipl_InicData.FwBuildVersion   = DEFAULTVAL_UINT32; /*! \internal Jira UN-376 */
-        Ipl_InicData.FwCrc            = DEFAULTVAL_UINT16; /*! \internal Jira UN-376 */
-        Ipl_Trace(Ipl_TraceTag(res), "Ipl_ReadFirmwareVersion returned 0x%02X", res);
-    }
     return res;
 }
 
@@ -808,14 +947,18 @@ static uint8_t Ipl_ReadFirmwareVersion(void)
 /*! \internal Sends a command to INIC and reads back the result. */
 uint8_t Ipl_ExecInicCmd(void)
 {
-    uint8_t rxlen, cmd, cc, rw;
-    uint32_t cid;
+    uint8_t rxlen, cmd, rw;
     uint8_t res = IPL_RES_ERR_TXTELLEN_INVALID;
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ExecInicCmd called with Command 0x%02X", Ipl_IplData.Tel[0]);
     /* Send telegram */
-    if ((INIC_MAX_TELLEN >= Ipl_IplData.TelLen) && (Ipl_IplData.TelLen != 0U))
+    if ((Ipl_TrpMaxTelLen() >= Ipl_IplData.TelLen) && (Ipl_IplData.TelLen != 0U))
     {
-        rw = Ipl_InicWrite(Ipl_IplData.TelLen, &Ipl_IplData.Tel[0]);
+        Ipl_IplData.RxPolled = IPL_LOW;
+#ifdef IPL_USE_INICTRANSFER
+        rw = Ipl_TransferInicCmd(Ipl_IplData.Tel[0]);
+#else
+        rw = Ipl_TrpInicWrite(Ipl_IplData.TelLen, &Ipl_IplData.Tel[0]);
+#endif
         if (0U == rw)
         {
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_InicWrite returned 0x%02X", rw);
@@ -828,313 +971,25 @@ uint8_t Ipl_ExecInicCmd(void)
         if (0U == rw)
         {
             res = IPL_RES_OK;
+#ifdef IPL_USE_INICTRANSFER
+            cmd = Ipl_IplData.TxCmd; /* Telegram buffer may already contain the response */
+#else
             Ipl_TraceTel(DIR_TX);
             /* Read response, store command and reset Buffer for RX */
             cmd = Ipl_IplData.Tel[0];
-            res = Ipl_WaitForResponse();
+#endif
+            res = Ipl_WaitForResponse(cmd);
             if (IPL_RES_OK == res)
             {
-                Ipl_ClrTel();
-                switch (cmd)
+                rxlen = Ipl_GetRxLen(cmd);
+                if (0U == rxlen)
                 {
-                    case CMD_PROGSTART:
-                        rxlen = CMD_PROGSTART_RXLEN;
-                        break;
-                    case CMD_READFWVER:
-                        rxlen = CMD_READFWVER_RXLEN;
-                        break;
-                    case CMD_READINFOMEM:
-                        rxlen = CMD_READINFOMEM_RXLEN;
-                        break;
-                    case CMD_CLEARCRC:
-                        rxlen = CMD_CLEARCRC_RXLEN;
-                        break;
-                    case CMD_ERASEINFOMEM:
-                        rxlen = CMD_ERASEINFOMEM_RXLEN;
-                        break;
-                    case CMD_ERASEPROGMEM:
-                        rxlen = CMD_ERASEPROGMEM_RXLEN;
-                        break;
-                    case CMD_GETCRC:
-                        rxlen = CMD_GETCRC_RXLEN;
-                        break;
-                    case CMD_READOTPMEM:
-                        rxlen = CMD_READOTPMEM_RXLEN;
-                        break;
-                    case CMD_READPROGMEM:
-                        rxlen = CMD_READPROGMEM_RXLEN;
-                        break;
-                    case CMD_SETPROGMEMPAGE:
-                        rxlen = CMD_SETPROGMEMPAGE_RXLEN;
-                        break;
-                    case CMD_VERIFYINFOMEM:
-                        rxlen = CMD_VERIFYINFOMEM_RXLEN;
-                        break;
-                    case CMD_VERIFYOTPMEM:
-                        rxlen = CMD_VERIFYOTPMEM_RXLEN;
-                        break;
-                    case CMD_WRITEINFOMEM:
-                        rxlen = CMD_WRITEINFOMEM_RXLEN;
-                        break;
-                    case CMD_WRITEOTPMEM:
-                        rxlen = CMD_WRITEOTPMEM_RXLEN;
-                        break;
-                    case CMD_WRITEPROGMEM:
-                        rxlen = CMD_WRITEPROGMEM_RXLEN;
-                        break;
-                    case CMD_WRITETESTMEM:
-                        rxlen = CMD_WRITETESTMEM_RXLEN;
-                        break;
-                    case CMD_READTESTMEM:
-                        rxlen = CMD_READTESTMEM_RXLEN;
-                        break;
-                    case CMD_LEG_READFWVER:
-                        rxlen = CMD_LEG_READFWVER_RXLEN;
-                        break;
-                    case CMD_LEG_ERASEENABLE:
-                        rxlen = CMD_LEG_ERASEENABLE_RXLEN;
-                        break;
-                    case CMD_LEG_ERASECS:
-                        rxlen = CMD_LEG_ERASECS_RXLEN;
-                        break;
-                    case CMD_LEG_WRITECS:
-                        rxlen = CMD_LEG_WRITECS_RXLEN;
-                        break;
-                    case CMD_LEG_GETCSINFO:
-                        rxlen = CMD_LEG_GETCSINFO_RXLEN;
-                        break;
-                    case CMD_READRAM:
-                        rxlen = CMD_READRAM_RXLEN;
-                        break;
-                    case CMD_READIOREG:
-                        rxlen = CMD_READIOREG_RXLEN;
-                        break;
-                    case CMD_READCPUREG:
-                        rxlen = CMD_READCPUREG_RXLEN;
-                        break;
-                    case CMD_READEXTIOREG:
-                        rxlen = CMD_READEXTIOREG_RXLEN;
-                        break;
-                    case CMD_READDATABUF:
-                        rxlen = CMD_READDATABUF_RXLEN;
-                        break;
-                    case CMD_READRT:
-                        rxlen = CMD_READRT_RXLEN;
-                        break;
-                    case CMD_READRF0:
-                        rxlen = CMD_READRF0_RXLEN;
-                        break;
-                    case CMD_READRF1:
-                        rxlen = CMD_READRF1_RXLEN;
-                        break;
-                    case CMD_WRITEIOREG:
-                        rxlen = CMD_WRITEIOREG_RXLEN;
-                        break;
-                    default:
-                        res = IPL_RES_ERR_CMD_UNEXPECTED;
-                        break;
+                    res = IPL_RES_ERR_CMD_UNEXPECTED;
                 }
                 if (IPL_RES_OK == res)
                 {
-                    rw = Ipl_InicRead(rxlen, &Ipl_IplData.Tel[0]);
-                    if (0U == rw)
-                    {
-                        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_InicRead returned 0x%02X", rw);
-                    }
-                    else
-                    {
-                        Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_InicRead returned 0x%02X", rw);
-                    }
-                    res = IPL_RES_ERR_READ;
-                    if (0x00U == rw)
-                    {
-                        Ipl_IplData.TelLen = rxlen;
-                        Ipl_TraceTel(DIR_RX);
-                        /* Parse response */
-                        cc = Ipl_IplData.Tel[0];
-                        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ExecInicCmd read CC 0x%02X", cc);
-#ifdef IPL_ALTERNATIVE_CRYSTAL
-                        if ( (cmd == CMD_PROGSTART) && (0x20 == cc) )  /*! \internal Case01308691 */
-                        {
-                            cc = IPL_RES_CC_OK;
-                            Ipl_Trace(IPL_TRACETAG_INFO, "Forced CC to 0x%02X because alternative crystal is used.", cc);
-                        }
-#endif
-                        if (IPL_RES_CC_OK == cc)
-                        {
-                            res = IPL_RES_OK;
-                            switch (cmd)
-                            {
-                                case CMD_READFWVER:
-                                    cid =  ((uint32_t) Ipl_IplData.Tel[6]) << 24U;
-                                    cid += ((uint32_t) Ipl_IplData.Tel[7]) << 16U;
-                                    cid += ((uint32_t) Ipl_IplData.Tel[8]) <<  8U;
-                                    cid += ((uint32_t) Ipl_IplData.Tel[9]) & 0xFFU;
-                                    switch (cid)
-                                    {
-                                        case 0x81118U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81118;
-                                            break;
-                                        case 0x81119U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81119;
-                                            break;
-                                        case 0x81210U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81210;
-                                            break;
-                                        case 0x81212U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81212;
-                                            break;
-                                        case 0x81214U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81214;
-                                            break;
-                                        case 0x81216U:
-                                            Ipl_InicData.ChipID = IPL_CHIP_OS81216;  /*! \internal Case00607049 */
-                                            break;
-                                        default:
-                                            Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_ExecInicCmd ChipID unexpected");
-                                            break;
-                                    }
-                                    Ipl_InicData.FwMajorVersion   =  Ipl_IplData.Tel[10];
-                                    Ipl_InicData.FwMinorVersion   =  Ipl_IplData.Tel[11];
-                                    Ipl_InicData.FwReleaseVersion =  Ipl_IplData.Tel[12];
-                                    Ipl_InicData.FwBuildVersion   =  ((uint32_t) Ipl_IplData.Tel[13]) << 24U;
-                                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[14]) << 16U;
-                                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[15]) <<  8U;
-                                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[16]) & 0xFFU;
-                                    Ipl_InicData.FwCrc            =  Ipl_IplData.Tel[19];
-                                    Ipl_InicData.FwVersionValid   =  VERSION_VALID;
-                                    break;
-                                case CMD_PROGSTART:
-                                case CMD_READINFOMEM:
-                                case CMD_CLEARCRC:
-                                case CMD_ERASEINFOMEM:
-                                case CMD_ERASEPROGMEM:
-                                case CMD_GETCRC:
-                                case CMD_READOTPMEM:
-                                case CMD_READPROGMEM:
-                                case CMD_SETPROGMEMPAGE:
-                                case CMD_VERIFYINFOMEM:
-                                case CMD_VERIFYOTPMEM:
-                                case CMD_WRITEINFOMEM:
-                                case CMD_WRITEOTPMEM:
-                                case CMD_WRITEPROGMEM:
-                                case CMD_WRITETESTMEM:
-                                case CMD_READTESTMEM:
-                                case CMD_LEG_ERASEENABLE:
-                                case CMD_LEG_ERASECS:
-                                case CMD_LEG_WRITECS:
-                                case CMD_READRAM:
-                                case CMD_READIOREG:
-                                case CMD_READCPUREG:
-                                case CMD_READEXTIOREG:
-                                case CMD_READDATABUF:
-                                case CMD_READRT:
-                                case CMD_READRF0:
-                                case CMD_READRF1:
-                                case CMD_WRITEIOREG:
-                                case CMD_LEG_GETCSINFO:
-                                    break;
-                                case CMD_LEG_READFWVER:
-                                    Ipl_InicData.ChipID = Ipl_IplData.Tel[12];
-                                    Ipl_InicData.FwMajorVersion   =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[9] );
-                                    Ipl_InicData.FwMinorVersion   =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[10] );
-                                    Ipl_InicData.FwReleaseVersion =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[11] );
-                                    Ipl_InicData.FwBuildVersion   =  0U;
-                                    Ipl_InicData.FwCrc            =  0U;
-                                    Ipl_InicData.FwVersionValid   =  VERSION_VALID;
-                                    break;
-                                default:
-                                    res = IPL_RES_ERR_RESP_UNEXPECTED;
-                                    break;
-                            }
-                        }
-                        else
-                        {
-                            switch (cmd)
-                            {
-                                case CMD_READFWVER:
-                                    Ipl_InicData.FwVersionValid = VERSION_INVALID;
-                                    res = IPL_RES_ERR_READFWVER;
-                                    break;
-                                case CMD_PROGSTART:
-                                    res = IPL_RES_ERR_PROGSTART;
-                                    break;
-                                case CMD_READINFOMEM:
-                                    res = IPL_RES_ERR_READINFOMEM;
-                                    break;
-                                case CMD_CLEARCRC:
-                                    res = IPL_RES_ERR_CLEARCRC;
-                                    break;
-                                case CMD_ERASEINFOMEM:
-                                    res = IPL_RES_ERR_ERASEINFOMEM;
-                                    break;
-                                case CMD_ERASEPROGMEM:
-                                    res = IPL_RES_ERR_ERASEPROGMEM;
-                                    break;
-                                case CMD_GETCRC:
-                                    res = IPL_RES_ERR_GETCRC;
-                                    break;
-                                case CMD_READOTPMEM:
-                                    res = IPL_RES_ERR_READOTPMEM;
-                                    break;
-                                case CMD_READPROGMEM:
-                                    res = IPL_RES_ERR_READPROGMEM;
-                                    break;
-                                case CMD_SETPROGMEMPAGE:
-                                    res = IPL_RES_ERR_SETPROGMEMPAGE;
-                                    break;
-                                case CMD_VERIFYINFOMEM:
-                                    res = IPL_RES_ERR_VERIFYINFOMEM;
-                                    break;
-                                case CMD_VERIFYOTPMEM:
-                                    res = cc;
-                                    break;
-                                case CMD_WRITEINFOMEM:
-                                    res = IPL_RES_ERR_WRITEINFOMEM;
-                                    break;
-                                case CMD_WRITEOTPMEM:
-                                    res = IPL_RES_ERR_WRITEOTPMEM;
-                                    break;
-                                case CMD_WRITEPROGMEM:
-                                    res = IPL_RES_ERR_WRITEPROGMEM;
-                                    break;
-                                case CMD_WRITETESTMEM:
-                                case CMD_READTESTMEM:
-                                    res = IPL_RES_ERR_ACCESS_TESTMEM;
-                                    break;
-                                case CMD_READRAM:
-                                case CMD_READIOREG:
-                                case CMD_READCPUREG:
-                                case CMD_READEXTIOREG:
-                                case CMD_READDATABUF:
-                                case CMD_READRT:
-                                case CMD_READRF0:
-                                case CMD_READRF1:
-                                case CMD_WRITEIOREG:
-                                    res = IPL_RES_ERR_ACCESS_RAM;
-                                    break;
-                                case CMD_LEG_READFWVER:
-                                    Ipl_InicData.FwVersionValid = VERSION_INVALID;
-                                    res = IPL_RES_ERR_READFWVER; /* Mapped to known error */
-                                    break;
-                                case CMD_LEG_ERASEENABLE:
-                                    res = IPL_RES_ERR_ERASEPROGMEM; /* Mapped to known error */
-                                    break;
-                                case CMD_LEG_ERASECS:
-                                    res = IPL_RES_ERR_ERASEINFOMEM; /* Mapped to known error */
-                                    break;
-                                case CMD_LEG_WRITECS:
-                                    res = IPL_RES_ERR_WRITEINFOMEM; /* Mapped to known error */
-                                    break;
-                                case CMD_LEG_GETCSINFO:
-                                    res = IPL_RES_ERR_READINFOMEM; /* Mapped to known error */
-                                    break;
-                                default:
-                                    res = IPL_RES_ERR_RESP_UNEXPECTED;
-                                    break;
-                            }
-                        }
-                    }
+                    rw  = Ipl_ReadResponse(rxlen);
+                    res = Ipl_EvalResponse(cmd, rxlen, rw);
                 }
             }
         }
@@ -1144,68 +999,705 @@ uint8_t Ipl_ExecInicCmd(void)
 }
 
 
-/*! \internal Checks if the connected INIC fits to the Parameter of Ipl_EnterProgMode */
-static uint8_t Ipl_CheckConnectedInic(void)
+/*! \internal Sends a command to INIC, reads the response as soon as INIC completed the command and
+ *  returns the time (in us) this took. The wait time of the command is the timeout. */
+uint8_t Ipl_MeasureInicCmd(uint32_t* pTime)
 {
-    uint8_t res = IPL_RES_ERR_WRONG_INIC;
-    if (Ipl_IplData.ChipID == Ipl_InicData.ChipID)
+    uint8_t  rw;
+    uint8_t  cmd     = Ipl_IplData.Tel[0];
+    uint8_t  rxlen   = Ipl_GetRxLen(cmd);
+    uint32_t timeout = Ipl_GetWaitTime(cmd);
+    uint32_t wtime   = 0U;
+    uint16_t reads   = 1U;
+    uint8_t  res     = IPL_RES_ERR_TXTELLEN_INVALID;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_MeasureInicCmd called with Command 0x%02X", cmd);
+    if ((Ipl_TrpMaxTelLen() >= Ipl_IplData.TelLen) && (Ipl_IplData.TelLen != 0U) && (0U != rxlen))
     {
-        res = IPL_RES_OK;
+        rw  = Ipl_TrpInicWrite(Ipl_IplData.TelLen, &Ipl_IplData.Tel[0]);
+        res = IPL_RES_ERR_WRITE;
+        if (0U == rw)
+        {
+            Ipl_TraceTel(DIR_TX);
+            /* INIC does not acknowledge the read with a completion code until the command is completed */
+            Ipl_ClrTel();
+            rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+            while (((0U != rw) || (0x00U == Ipl_IplData.Tel[0])) && (wtime < timeout))
+            {
+                wtime += Ipl_Delay(INIC_CALIB_STEP_TIME);
+                reads++;
+                Ipl_ClrTel();
+                rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+            }
+            res = Ipl_EvalResponse(cmd, rxlen, rw);
+            *pTime = wtime;
+        }
     }
-    Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckConnectedInic returned 0x%02X", res);
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_MeasureInicCmd returned 0x%02X after %u us (%u reads)", res, wtime, reads);
     return res;
 }
 
 
+/*! \internal Executes the referred telegrams in order, as many as possible in one batch. Stops on the first error. */
+uint8_t Ipl_ExecInicCmdBatch(Ipl_Telegram_t tel[], uint8_t num)
+{
+    uint8_t res = IPL_RES_OK;
+    uint8_t i = 0U;
+    uint8_t j;
+    uint8_t done;
+#ifdef IPL_USE_INICBATCH
+    uint8_t run;
+#endif
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ExecInicCmdBatch called with %u telegrams", num);
+    while ((i < num) && (IPL_RES_OK == res))
+    {
+        done = 0U;
+#ifdef IPL_USE_INICBATCH
+        run = Ipl_PrepareBatch(&tel[i], num - i);
+        if (0U != run)
+        {
+            done = Ipl_TrpInicTransferBatch(run, &tel[i]);
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_InicTransferBatch returned %u of %u telegrams", done, run);
+            if (done > run)
+            {
+                done = run;
+            }
+            for (j=0U; (j<done) && (IPL_RES_OK == res); j++)
+            {
+#ifdef IPL_USE_COMPLETION_POLLING
+                if (1U != tel[i+j].Res) /* The transport waited TimeUs before reading the response */
+                {
+                    Ipl_UpdateCmdStat(tel[i+j].Tx[0], tel[i+j].TimeUs,
+                                      ((0U != tel[i+j].PollUs) && (0U == tel[i+j].Res) && (0x00U != tel[i+j].Rx[0])) ? IPL_HIGH : IPL_LOW);
+                }
+#endif
+                res = Ipl_EvalBatchTel(&tel[i+j]);
+            }
+        }
+#endif
+        if (0U == done)
+        {
+            /* Telegram cannot be batched, so it is executed on its own */
+            Ipl_ClrTel();
+            for (j=0U; (j<tel[i].TxLen) && (j<INIC_MAX_TELLEN); j++)
+            {
+                Ipl_IplData.Tel[j] = tel[i].Tx[j];
+            }
+            Ipl_IplData.TelLen = tel[i].TxLen;
+            res = Ipl_ExecInicCmd();
+            done = 1U;
+        }
+        i += done;
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_ExecInicCmdBatch returned 0x%02X", res);
+    return res;
+}
+
 
-/*! \internal Checks if the ChipID of the IPF data is equal to the connected INIC */
-uint8_t Ipl_CheckChipId(void)
+/*! \internal Queues the telegram in the buffer for batch execution. The queue is executed when it is full or the telegram cannot be batched. */
+uint8_t Ipl_QueueInicCmd(void)
 {
-    uint8_t res = IPL_RES_ERR_IPF_WRONGINIC;
-    if (Ipl_InicData.ChipID == Ipl_IpfData.ChipID)
+    uint8_t res;
+#ifdef IPL_USE_INICBATCH
+    uint8_t i;
+    Ipl_Telegram_t* pTel;
+    if (IPL_LOW == Ipl_TrpHasCap(IPL_TRP_CAP_BATCH))
+    {
+        res = Ipl_ExecInicCmd();
+    }
+    else if ((0U != Ipl_IplData.TelLen) && (INIC_MAX_TELLEN >= Ipl_IplData.TelLen))
     {
+        pTel = &Ipl_IplData.Batch[Ipl_IplData.BatchLen];
+        for (i=0U; i<Ipl_IplData.TelLen; i++)
+        {
+            pTel->Tx[i] = Ipl_IplData.Tel[i];
+        }
+        pTel->TxLen = Ipl_IplData.TelLen;
+        Ipl_IplData.BatchLen++;
         res = IPL_RES_OK;
+        if ((INIC_MAX_BATCH == Ipl_IplData.BatchLen) || (IPL_LOW == Ipl_IsBatchable(pTel->Tx[0])))
+        {
+            res = Ipl_FlushInicCmds();
+        }
     }
-    if (IPL_RES_OK != res)
+    else
     {
-        /* No valid ChipID could be determined in connected INIC */                 /*! \internal Jira UN-376 */
-        switch (Ipl_IpfData.ChipID)                                                 /*! \internal Jira UN-376 */
-        {                                                                           /*! \internal Jira UN-376 */
-            case IPL_CHIP_OS81118:                                                  /*! \internal Jira UN-376 */
-            case IPL_CHIP_OS81119:                                                  /*! \internal Jira UN-376 */
-            case IPL_CHIP_OS81050:                                                  /*! \internal Jira UN-376 */
-            case IPL_CHIP_OS81082:                                                  /*! \internal Jira UN-376 */
-            case IPL_CHIP_OS81110:                                                  /*! \internal Jira UN-376 */
-                /* If we assume a Flash Chip, we can try programming */             /*! \internal Jira UN-376 */
-                res = IPL_RES_OK;                                                   /*! \internal Jira UN-376 */
-                break;                                                              /*! \internal Jira UN-376 */
-            default:                                                                /*! \internal Jira UN-376 */
-                res = IPL_RES_ERR_NOVALIDCHIPID;                                    /*! \internal Jira UN-376 */
-                /* If we assume a ROM chip, we do not touch it */                   /*! \internal Jira UN-376 */
-                break;                                                              /*! \internal Jira UN-376 */
-        }                                                                           /*! \internal Jira UN-376 */
+        res = Ipl_FlushInicCmds();
+        if (IPL_RES_OK == res)
+        {
+            res = IPL_RES_ERR_TXTELLEN_INVALID;
+            Ipl_Trace(Ipl_TraceTag(res), "Ipl_QueueInicCmd returned 0x%02X", res);
+        }
     }
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckChipId IPF ChipID 0x%2X", Ipl_IpfData.ChipID);
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckChipId connected INIC with ChipID 0x%2X", Ipl_InicData.ChipID);
-    Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckChipId returned 0x%02X", res);
+#else
+    res = Ipl_ExecInicCmd();
+#endif
     return res;
 }
 
 
-/*! \internal Checks, if the FW Version stored in the IPF data is equal to the FW version in the connected INIC */
-uint8_t Ipl_CheckInicFwVersion(void)
+/*! \internal Executes all telegrams queued by Ipl_QueueInicCmd(). */
+uint8_t Ipl_FlushInicCmds(void)
 {
-    uint8_t res;
-    res = Ipl_CheckChipId();
-    if (IPL_RES_OK == res)
+    uint8_t res = IPL_RES_OK;
+#ifdef IPL_USE_INICBATCH
+    if (0U != Ipl_IplData.BatchLen)
+    {
+        res = Ipl_ExecInicCmdBatch(Ipl_IplData.Batch, Ipl_IplData.BatchLen);
+        Ipl_IplData.BatchLen = 0U;
+    }
+#endif
+    return res;
+}
+
+
+#ifdef IPL_USE_INICBATCH
+/*! \internal Returns IPL_HIGH if the transport can wait for the response to the referred command on its own, only such telegrams are batched. */
+static uint8_t Ipl_IsBatchable(uint8_t cmd)
+{
+    uint8_t res = (0U != Ipl_GetRxLen(cmd)) ? IPL_HIGH : IPL_LOW;
+#ifdef IPL_USE_INTPIN
+    if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_INTPIN))
+    {
+        res = IPL_LOW; /* INT_ pin is checked before reading */
+    }
+#endif
+#ifdef IPL_USE_ERASE_POLLING
+    if ((CMD_ERASEPROGMEM == cmd) || (CMD_ERASEINFOMEM == cmd))
+    {
+        res = IPL_LOW; /* Progress is indicated while polling */
+    }
+#endif
+    return res;
+}
+
+
+/*! \internal Prepares the leading telegrams the transport can wait for and returns their number. */
+static uint8_t Ipl_PrepareBatch(Ipl_Telegram_t tel[], uint8_t num)
+{
+    uint8_t run = 0U;
+    uint8_t i;
+    uint8_t max = num;
+    if (IPL_LOW == Ipl_TrpHasCap(IPL_TRP_CAP_BATCH))
+    {
+        max = 0U; /* Transport cannot batch, telegrams are executed on their own */
+    }
+    while ((run < max) && (0U != tel[run].TxLen) && (Ipl_TrpMaxTelLen() >= tel[run].TxLen) &&
+           (IPL_HIGH == Ipl_IsBatchable(tel[run].Tx[0])))
+    {
+        tel[run].RxLen   = Ipl_GetRxLen(tel[run].Tx[0]);
+        tel[run].DelayUs = Ipl_GetWaitTime(tel[run].Tx[0]);
+        tel[run].PollUs  = 0U;
+#ifdef IPL_USE_COMPLETION_POLLING
+        if (CMD_WRITEPROGMEM == tel[run].Tx[0])
+        {
+            tel[run].PollUs = INIC_POLL_START_TIME; /* DelayUs is the timeout of polling */
+        }
+#endif
+        tel[run].TimeUs  = 0U;
+        tel[run].Res     = 0U;
+        for (i=0U; i<tel[run].TxLen; i++)
+        {
+            Ipl_IplData.Tel[i] = tel[run].Tx[i];
+        }
+        Ipl_IplData.TelLen = tel[run].TxLen;
+        Ipl_TraceTel(DIR_TX);
+        run++;
+    }
+    return run;
+}
+
+
+/*! \internal Evaluates a telegram executed by Ipl_InicTransferBatch() the same way as Ipl_ExecInicCmd() does. */
+static uint8_t Ipl_EvalBatchTel(const Ipl_Telegram_t* pTel)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t cmd = pTel->Tx[0];
+    if (1U == pTel->Res)
+    {
+        Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_InicTransferBatch failed to send Command 0x%02X", cmd);
+        res = IPL_RES_ERR_WRITE;
+    }
+    else
+    {
+        Ipl_ClrTel();
+        if (0U == pTel->Res)
+        {
+            for (i=0U; i<pTel->RxLen; i++)
+            {
+                Ipl_IplData.Tel[i] = pTel->Rx[i];
+            }
+        }
+        res = Ipl_EvalResponse(cmd, pTel->RxLen, pTel->Res);
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_ExecInicCmdBatch Command 0x%02X returned 0x%02X", cmd, res);
+    return res;
+}
+#endif
+
+
+/*! \internal Evaluates the result of reading the response and the response itself. */
+static uint8_t Ipl_EvalResponse(uint8_t cmd, uint8_t rxlen, uint8_t rw)
+{
+    uint8_t  cc;
+    uint32_t cid;
+    uint8_t  res;
+    if (0U == rw)
+    {
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_InicRead returned 0x%02X", rw);
+    }
+    else
+    {
+        Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_InicRead returned 0x%02X", rw);
+    }
+    res = IPL_RES_ERR_READ;
+    if (0x00U == rw)
+    {
+        Ipl_IplData.TelLen = rxlen;
+        Ipl_TraceTel(DIR_RX);
+        /* Parse response */
+        cc = Ipl_IplData.Tel[0];
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ExecInicCmd read CC 0x%02X", cc);
+#ifdef IPL_ALTERNATIVE_CRYSTAL
+        if ( (cmd == CMD_PROGSTART) && (0x20 == cc) )  /*! \internal Case01308691 */
+        {
+            cc = IPL_RES_CC_OK;
+            Ipl_Trace(IPL_TRACETAG_INFO, "Forced CC to 0x%02X because alternative crystal is used.", cc);
+        }
+#endif
+        if (IPL_RES_CC_OK == cc)
+        {
+            res = IPL_RES_OK;
+            switch (cmd)
+            {
+                case CMD_READFWVER:
+                    cid =  ((uint32_t) Ipl_IplData.Tel[6]) << 24U;
+                    cid += ((uint32_t) Ipl_IplData.Tel[7]) << 16U;
+                    cid += ((uint32_t) Ipl_IplData.Tel[8]) <<  8U;
+                    cid += ((uint32_t) Ipl_IplData.Tel[9]) & 0xFFU;
+                    switch (cid)
+                    {
+                        case 0x81118U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81118;
+                            break;
+                        case 0x81119U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81119;
+                            break;
+                        case 0x81210U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81210;
+                            break;
+                        case 0x81212U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81212;
+                            break;
+                        case 0x81214U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81214;
+                            break;
+                        case 0x81216U:
+                            Ipl_InicData.ChipID = IPL_CHIP_OS81216;  /*! \internal Case00607049 */
+                            break;
+                        default:
+                            Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_ExecInicCmd ChipID unexpected");
+                            break;
+                    }
+                    Ipl_InicData.FwMajorVersion   =  Ipl_IplData.Tel[10];
+                    Ipl_InicData.FwMinorVersion   =  Ipl_IplData.Tel[11];
+                    Ipl_InicData.FwReleaseVersion =  Ipl_IplData.Tel[12];
+                    Ipl_InicData.FwBuildVersion   =  ((uint32_t) Ipl_IplData.Tel[13]) << 24U;
+                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[14]) << 16U;
+                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[15]) <<  8U;
+                    Ipl_InicData.FwBuildVersion   += ((uint32_t) Ipl_IplData.Tel[16]) & 0xFFU;
+                    Ipl_InicData.FwCrc            =  Ipl_IplData.Tel[19];
+                    Ipl_InicData.FwVersionValid   =  VERSION_VALID;
+                    break;
+                case CMD_PROGSTART:
+                case CMD_READINFOMEM:
+                case CMD_CLEARCRC:
+                case CMD_ERASEINFOMEM:
+                case CMD_ERASEPROGMEM:
+                case CMD_GETCRC:
+                case CMD_READOTPMEM:
+                case CMD_READPROGMEM:
+                case CMD_SETPROGMEMPAGE:
+                case CMD_VERIFYINFOMEM:
+                case CMD_VERIFYOTPMEM:
+                case CMD_WRITEINFOMEM:
+                case CMD_WRITEOTPMEM:
+                case CMD_WRITEPROGMEM:
+                case CMD_WRITETESTMEM:
+                case CMD_READTESTMEM:
+                case CMD_LEG_ERASEENABLE:
+                case CMD_LEG_ERASECS:
+                case CMD_LEG_WRITECS:
+                case CMD_READRAM:
+                case CMD_READIOREG:
+                case CMD_READCPUREG:
+                case CMD_READEXTIOREG:
+                case CMD_READDATABUF:
+                case CMD_READRT:
+                case CMD_READRF0:
+                case CMD_READRF1:
+                case CMD_WRITEIOREG:
+                case CMD_LEG_GETCSINFO:
+                    break;
+                case CMD_LEG_READFWVER:
+                    Ipl_InicData.ChipID = Ipl_IplData.Tel[12];
+                    Ipl_InicData.FwMajorVersion   =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[9] );
+                    Ipl_InicData.FwMinorVersion   =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[10] );
+                    Ipl_InicData.FwReleaseVersion =  Ipl_Bcd2Byte ( Ipl_IplData.Tel[11] );
+                    Ipl_InicData.FwBuildVersion   =  0U;
+                    Ipl_InicData.FwCrc            =  0U;
+                    Ipl_InicData.FwVersionValid   =  VERSION_VALID;
+                    break;
+                default:
+                    res = IPL_RES_ERR_RESP_UNEXPECTED;
+                    break;
+            }
+        }
+        else
+        {
+            switch (cmd)
+            {
+                case CMD_READFWVER:
+                    Ipl_InicData.FwVersionValid = VERSION_INVALID;
+                    res = IPL_RES_ERR_READFWVER;
+                    break;
+                case CMD_PROGSTART:
+                    res = IPL_RES_ERR_PROGSTART;
+                    break;
+                case CMD_READINFOMEM:
+                    res = IPL_RES_ERR_READINFOMEM;
+                    break;
+                case CMD_CLEARCRC:
+                    res = IPL_RES_ERR_CLEARCRC;
+                    break;
+                case CMD_ERASEINFOMEM:
+                    res = IPL_RES_ERR_ERASEINFOMEM;
+                    break;
+                case CMD_ERASEPROGMEM:
+                    res = IPL_RES_ERR_ERASEPROGMEM;
+                    break;
+                case CMD_GETCRC:
+                    res = IPL_RES_ERR_GETCRC;
+                    break;
+                case CMD_READOTPMEM:
+                    res = IPL_RES_ERR_READOTPMEM;
+                    break;
+                case CMD_READPROGMEM:
+                    res = IPL_RES_ERR_READPROGMEM;
+                    break;
+                case CMD_SETPROGMEMPAGE:
+                    res = IPL_RES_ERR_SETPROGMEMPAGE;
+                    break;
+                case CMD_VERIFYINFOMEM:
+                    res = IPL_RES_ERR_VERIFYINFOMEM;
+                    break;
+                case CMD_VERIFYOTPMEM:
+                    res = cc;
+                    break;
+                case CMD_WRITEINFOMEM:
+                    res = IPL_RES_ERR_WRITEINFOMEM;
+                    break;
+                case CMD_WRITEOTPMEM:
+                    res = IPL_RES_ERR_WRITEOTPMEM;
+                    break;
+                case CMD_WRITEPROGMEM:
+                    res = IPL_RES_ERR_WRITEPROGMEM;
+                    break;
+                case CMD_WRITETESTMEM:
+                case CMD_READTESTMEM:
+                    res = IPL_RES_ERR_ACCESS_TESTMEM;
+                    break;
+                case CMD_READRAM:
+                case CMD_READIOREG:
+                case CMD_READCPUREG:
+                case CMD_READEXTIOREG:
+                case CMD_READDATABUF:
+                case CMD_READRT:
+                case CMD_READRF0:
+                case CMD_READRF1:
+                case CMD_WRITEIOREG:
+                    res = IPL_RES_ERR_ACCESS_RAM;
+                    break;
+                case CMD_LEG_READFWVER:
+                    Ipl_InicData.FwVersionValid = VERSION_INVALID;
+                    res = IPL_RES_ERR_READFWVER; /* Mapped to known error */
+                    break;
+                case CMD_LEG_ERASEENABLE:
+                    res = IPL_RES_ERR_ERASEPROGMEM; /* Mapped to known error */
+                    break;
+                case CMD_LEG_ERASECS:
+                    res = IPL_RES_ERR_ERASEINFOMEM; /* Mapped to known error */
+                    break;
+                case CMD_LEG_WRITECS:
+                    res = IPL_RES_ERR_WRITEINFOMEM; /* Mapped to known error */
+                    break;
+                case CMD_LEG_GETCSINFO:
+                    res = IPL_RES_ERR_READINFOMEM; /* Mapped to known error */
+                    break;
+                default:
+                    res = IPL_RES_ERR_RESP_UNEXPECTED;
+                    break;
+            }
+        }
+    }
+    return res;
+}
+
+
+/*! \internal Returns the length of the response to the referred command, 0 if the command is unknown. */
+static uint8_t Ipl_GetRxLen(uint8_t cmd)
+{
+    uint8_t rxlen;
+    switch (cmd)
+    {
+        case CMD_PROGSTART:
+            rxlen = CMD_PROGSTART_RXLEN;
+            break;
+        case CMD_READFWVER:
+            rxlen = CMD_READFWVER_RXLEN;
+            break;
+        case CMD_READINFOMEM:
+            rxlen = CMD_READINFOMEM_RXLEN + Ipl_GetExtDataLen();
+            break;
+        case CMD_CLEARCRC:
+            rxlen = CMD_CLEARCRC_RXLEN;
+            break;
+        case CMD_ERASEINFOMEM:
+            rxlen = CMD_ERASEINFOMEM_RXLEN;
+            break;
+        case CMD_ERASEPROGMEM:
+            rxlen = CMD_ERASEPROGMEM_RXLEN;
+            break;
+        case CMD_GETCRC:
+            rxlen = CMD_GETCRC_RXLEN;
+            break;
+        case CMD_READOTPMEM:
+            rxlen = CMD_READOTPMEM_RXLEN + Ipl_GetExtDataLen();
+            break;
+        case CMD_READPROGMEM:
+            rxlen = CMD_READPROGMEM_RXLEN + Ipl_GetExtDataLen();
+            break;
+        case CMD_SETPROGMEMPAGE:
+            rxlen = CMD_SETPROGMEMPAGE_RXLEN;
+            break;
+        case CMD_VERIFYINFOMEM:
+            rxlen = CMD_VERIFYINFOMEM_RXLEN;
+            break;
+        case CMD_VERIFYOTPMEM:
+            rxlen = CMD_VERIFYOTPMEM_RXLEN;
+            break;
+        case CMD_WRITEINFOMEM:
+            rxlen = CMD_WRITEINFOMEM_RXLEN;
+            break;
+        case CMD_WRITEOTPMEM:
+            rxlen = CMD_WRITEOTPMEM_RXLEN;
+            break;
+        case CMD_WRITEPROGMEM:
+            rxlen = CMD_WRITEPROGMEM_RXLEN;
+            break;
+        case CMD_WRITETESTMEM:
+            rxlen = CMD_WRITETESTMEM_RXLEN;
+            break;
+        case CMD_READTESTMEM:
+            rxlen = CMD_READTESTMEM_RXLEN + Ipl_GetExtDataLen();
+            break;
+        case CMD_LEG_READFWVER:
+            rxlen = CMD_LEG_READFWVER_RXLEN;
+            break;
+        case CMD_LEG_ERASEENABLE:
+            rxlen = CMD_LEG_ERASEENABLE_RXLEN;
+            break;
+        case CMD_LEG_ERASECS:
+            rxlen = CMD_LEG_ERASECS_RXLEN;
+            break;
+        case CMD_LEG_WRITECS:
+            rxlen = CMD_LEG_WRITECS_RXLEN;
+            break;
+        case CMD_LEG_GETCSINFO:
+            rxlen = CMD_LEG_GETCSINFO_RXLEN;
+            break;
+        case CMD_READRAM:
+            rxlen = CMD_READRAM_RXLEN;
+            break;
+        case CMD_READIOREG:
+            rxlen = CMD_READIOREG_RXLEN;
+            break;
+        case CMD_READCPUREG:
+            rxlen = CMD_READCPUREG_RXLEN;
+            break;
+        case CMD_READEXTIOREG:
+            rxlen = CMD_READEXTIOREG_RXLEN;
+            break;
+        case CMD_READDATABUF:
+            rxlen = CMD_READDATABUF_RXLEN;
+            break;
+        case CMD_READRT:
+            rxlen = CMD_READRT_RXLEN;
+            break;
+        case CMD_READRF0:
+            rxlen = CMD_READRF0_RXLEN;
+            break;
+        case CMD_READRF1:
+            rxlen = CMD_READRF1_RXLEN;
+            break;
+        case CMD_WRITEIOREG:
+            rxlen = CMD_WRITEIOREG_RXLEN;
+            break;
+        default:
+            rxlen = 0U;
+            break;
+    }
+    return rxlen;
+}
+
+
+/*! \internal Returns the time (in us) to wait for the response to the referred command. */
+static uint32_t Ipl_GetWaitTime(uint8_t cmd)
+{
+    uint32_t waittime;
+    switch (cmd)
+    {
+        case CMD_WRITEPROGMEM:
+            waittime = Ipl_Timing.ProgramWaitTime;
+            break;
+        case CMD_ERASEPROGMEM:
+            waittime = Ipl_Timing.EraseProgMemWaitTime;
+            break;
+        case CMD_ERASEINFOMEM:
+            waittime = Ipl_Timing.EraseInfoMemWaitTime;
+            break;
+        default:
+            waittime = Ipl_Timing.RespWaitTime;
+            break;
+    }
+    return waittime;
+}
+
+
+#ifdef IPL_USE_INICTRANSFER
+/*! \internal Sends the telegram and, if only a delay is needed before, reads the response in the same transfer. */
+static uint8_t Ipl_TransferInicCmd(uint8_t cmd)
+{
+    uint8_t rw;
+    uint8_t i;
+    uint8_t rxlen = Ipl_GetRxLen(cmd);
+    Ipl_IplData.TxCmd = cmd;
+    Ipl_TraceTel(DIR_TX);
+    if ((0U != rxlen) && (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_TRANSFER)) && (IPL_HIGH == Ipl_IsDelayOnly(cmd)))
+    {
+        /* Response overwrites the telegram, INIC gets it before the response is stored */
+        rw = Ipl_TrpInicTransfer(Ipl_IplData.TelLen, &Ipl_IplData.Tel[0], rxlen, &Ipl_IplData.Tel[0], Ipl_GetWaitTime(cmd));
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_InicTransfer returned 0x%02X", rw);
+        if (1U != rw) /* Telegram was sent */
+        {
+            for (i=rxlen; i<INIC_MAX_TELLEN; i++)
+            {
+                Ipl_IplData.Tel[i] = 0x00U; /* Same buffer content as after Ipl_ClrTel() and Ipl_InicRead() */
+            }
+            Ipl_IplData.RxPolled = IPL_HIGH;
+            Ipl_IplData.RxRes    = rw;
+            rw = 0U;
+        }
+    }
+    else
+    {
+        rw = Ipl_TrpInicWrite(Ipl_IplData.TelLen, &Ipl_IplData.Tel[0]);
+    }
+    return rw;
+}
+#endif
+
+
+#ifdef IPL_USE_INICTRANSFER
+/*! \internal Returns IPL_HIGH if nothing but a delay is needed between sending the referred command and reading its response. */
+static uint8_t Ipl_IsDelayOnly(uint8_t cmd)
+{
+    uint8_t res = IPL_HIGH;
+#ifdef IPL_USE_INTPIN
+    if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_INTPIN))
+    {
+        res = IPL_LOW; /* INT_ pin is checked before reading */
+    }
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+    if (CMD_WRITEPROGMEM == cmd)
+    {
+        res = IPL_LOW;
+    }
+#endif
+#ifdef IPL_USE_ERASE_POLLING
+    if ((CMD_ERASEPROGMEM == cmd) || (CMD_ERASEINFOMEM == cmd))
+    {
+        res = IPL_LOW;
+    }
+#endif
+    return res;
+}
+#endif
+
+
+/*! \internal Checks if the connected INIC fits to the Parameter of Ipl_EnterProgMode */
+static uint8_t Ipl_CheckConnectedInic(void)
+{
+    uint8_t res = IPL_RES_ERR_WRONG_INIC;
+    if (Ipl_IplData.ChipID == Ipl_InicData.ChipID)
+    {
+        res = IPL_RES_OK;
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckConnectedInic returned 0x%02X", res);
+    return res;
+}
+
+
+
+/*! \internal Checks if the ChipID of the IPF data is equal to the connected INIC */
+uint8_t Ipl_CheckChipId(const Ipl_IpfData_t *ipf)
+{
+    uint8_t res = IPL_RES_ERR_IPF_WRONGINIC;
+    if (Ipl_InicData.ChipID == ipf->ChipID)
+    {
+        res = IPL_RES_OK;
+    }
+    if (IPL_RES_OK != res)
+    {
+        /* No valid ChipID could be determined in connected INIC */                 /*! \internal Jira UN-376 */
+        switch (ipf->ChipID)                                                 /*! \internal Jira UN-376 */
+        {                                                                           /*! \internal Jira UN-376 */
+            case IPL_CHIP_OS81118:                                                  /*! \internal Jira UN-376 */
+            case IPL_CHIP_OS81119:                                                  /*! \internal Jira UN-376 */
+            case IPL_CHIP_OS81050:                                                  /*! \internal Jira UN-376 */
+            case IPL_CHIP_OS81082:                                                  /*! \internal Jira UN-376 */
+            case IPL_CHIP_OS81110:                                                  /*! \internal Jira UN-376 */
+                /* If we assume a Flash Chip, we can try programming */             /*! \internal Jira UN-376 */
+                res = IPL_RES_OK;                                                   /*! \internal Jira UN-376 */
+                break;                                                              /*! \internal Jira UN-376 */
+            default:                                                                /*! \internal Jira UN-376 */
+                res = IPL_RES_ERR_NOVALIDCHIPID;                                    /*! \internal Jira UN-376 */
+                /* If we assume a ROM chip, we do not touch it */                   /*! \internal Jira UN-376 */
+                break;                                                              /*! \internal Jira UN-376 */
+        }                                                                           /*! \internal Jira UN-376 */
+    }
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckChipId IPF ChipID 0x%2X", ipf->ChipID);
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckChipId connected INIC with ChipID 0x%2X", Ipl_InicData.ChipID);
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckChipId returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Checks, if the FW Version stored in the IPF data is equal to the FW version in the connected INIC */
+uint8_t Ipl_CheckInicFwVersion(const Ipl_IpfData_t *ipf)
+{
+    uint8_t res;
+    res = Ipl_CheckChipId(ipf);
+    if (IPL_RES_OK == res)
     {
         /* additional version check */
         Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckInicFwVersion FW IPF Meta (Val %u) - V%u.%u.%u-%u",
-                Ipl_IpfData.Meta.FwVersionValid,
-                Ipl_IpfData.Meta.FwMajorVersion,
-                Ipl_IpfData.Meta.FwMinorVersion,
-                Ipl_IpfData.Meta.FwReleaseVersion,
-                Ipl_IpfData.Meta.FwBuildVersion);
+                ipf->Meta.FwVersionValid,
+                ipf->Meta.FwMajorVersion,
+                ipf->Meta.FwMinorVersion,
+                ipf->Meta.FwReleaseVersion,
+                ipf->Meta.FwBuildVersion);
         Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckInicFwVersion FW connected INIC (Val %u) V%u.%u.%u-%u",
                 Ipl_InicData.FwVersionValid,
                 Ipl_InicData.FwMajorVersion,
@@ -1214,12 +1706,12 @@ uint8_t Ipl_CheckInicFwVersion(void)
                 Ipl_InicData.FwBuildVersion);
         if (VERSION_VALID == Ipl_InicData.FwVersionValid)                                      /*! \internal Jira UN-582, UN-581 */
         {                                                                                      /*! \internal Jira UN-582, UN-581 */
-            if (VERSION_VALID == Ipl_IpfData.Meta.FwVersionValid)                              /*! \internal Jira UN-582, UN-581 */
+            if (VERSION_VALID == ipf->Meta.FwVersionValid)                              /*! \internal Jira UN-582, UN-581 */
             {                                                                                  /*! \internal Jira UN-582, UN-581 */
-                if ((Ipl_IpfData.Meta.FwMajorVersion != Ipl_InicData.FwMajorVersion)   ||      /*! \internal Jira UN-582, UN-581 */
-                (Ipl_IpfData.Meta.FwMinorVersion     != Ipl_InicData.FwMinorVersion)   ||      /*! \internal Jira UN-582, UN-581 */
-                (Ipl_IpfData.Meta.FwReleaseVersion   != Ipl_InicData.FwReleaseVersion) ||      /*! \internal Jira UN-582, UN-581 */
-                (Ipl_IpfData.Meta.FwBuildVersion     != Ipl_InicData.FwBuildVersion))          /*! \internal Jira UN-582, UN-581 */
+                if ((ipf->Meta.FwMajorVersion != Ipl_InicData.FwMajorVersion)   ||      /*! \internal Jira UN-582, UN-581 */
+                (ipf->Meta.FwMinorVersion     != Ipl_InicData.FwMinorVersion)   ||      /*! \internal Jira UN-582, UN-581 */
+                (ipf->Meta.FwReleaseVersion   != Ipl_InicData.FwReleaseVersion) ||      /*! \internal Jira UN-582, UN-581 */
+                (ipf->Meta.FwBuildVersion     != Ipl_InicData.FwBuildVersion))          /*! \internal Jira UN-582, UN-581 */
                 {                                                                              /*! \internal Jira UN-582, UN-581 */
                     res = IPL_RES_ERR_IPF_WRONGFWVERSION;                                      /*! \internal Jira UN-582, UN-581 */
                 }                                                                              /*! \internal Jira UN-582, UN-581 */
@@ -1245,16 +1737,16 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
 
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckUpdate called with %u byte IPF, StringType 0x%02X", lData, stringType);
     /* Check if correct string is contained in IPF data */
-    res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, stringType);
+    res = Ipl_ParseIpf(ipf, lData, pData, stringType);
     if (IPL_RES_OK == res)
     {
         /* Get IPF versions from metadata */
-        res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, STRINGTYPE_META);
+        res = Ipl_ParseIpf(ipf, lData, pData, STRINGTYPE_META);
         if ((STRINGTYPE_CONFIG == stringType) || (STRINGTYPE_CS == stringType))
         {
             /* First check if FW version is valid */
-            res = Ipl_CheckInicFwVersion();
-            if ( (VERSION_INVALID == Ipl_IpfData.Meta.FwVersionValid) ||         /*! \internal Jira UN-582, UN-581 */
+            res = Ipl_CheckInicFwVersion(ipf);
+            if ( (VERSION_INVALID == ipf->Meta.FwVersionValid) ||         /*! \internal Jira UN-582, UN-581 */
                  (VERSION_INVALID == Ipl_InicData.FwVersionValid) )              /*! \internal Jira UN-582, UN-581 */
             {                                                                    /*! \internal Jira UN-582, UN-581 */
                 res = IPL_RES_UPDATE_DENIED_UNKNOWN;                             /*! \internal Jira UN-582, UN-581 */
@@ -1262,7 +1754,7 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
             else if (IPL_RES_OK == res)                                          /*! \internal Jira UN-581 */
             {
                 /* If any version is not valid */
-                if ((VERSION_INVALID == Ipl_IpfData.Meta.CfgsVersionValid) || (VERSION_INVALID == Ipl_InicData.CfgsVersionValid))
+                if ((VERSION_INVALID == ipf->Meta.CfgsVersionValid) || (VERSION_INVALID == Ipl_InicData.CfgsVersionValid))
                 {
                     res = IPL_RES_UPDATE_DENIED_UNKNOWN;
                     /* If version in INIC is not valid */
@@ -1273,9 +1765,9 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
                 }
                 else /* All versions are valid, we can compare them */
                 {
-                    vipf  =   (uint32_t) ( (uint32_t) Ipl_IpfData.Meta.CfgsCustMajorVersion << 16U )
-                            + (uint32_t) ( (uint32_t) Ipl_IpfData.Meta.CfgsCustMinorVersion << 8U )
-                            + (uint32_t) Ipl_IpfData.Meta.CfgsCustReleaseVersion;
+                    vipf  =   (uint32_t) ( (uint32_t) ipf->Meta.CfgsCustMajorVersion << 16U )
+                            + (uint32_t) ( (uint32_t) ipf->Meta.CfgsCustMinorVersion << 8U )
+                            + (uint32_t) ipf->Meta.CfgsCustReleaseVersion;
                     vinic =   (uint32_t) ( (uint32_t) Ipl_InicData.CfgsCustMajorVersion << 16U )
                             + (uint32_t) ( (uint32_t) Ipl_InicData.CfgsCustMinorVersion << 8U )
                             + (uint32_t) Ipl_InicData.CfgsCustReleaseVersion;
@@ -1296,12 +1788,12 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
             }
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckUpdate ConfigString INIC: V%u.%u.%u IPF: V%u.%u.%u",
                 Ipl_InicData.CfgsCustMajorVersion, Ipl_InicData.CfgsCustMinorVersion, Ipl_InicData.CfgsCustReleaseVersion,
-                Ipl_IpfData.Meta.CfgsCustMajorVersion, Ipl_IpfData.Meta.CfgsCustMinorVersion, Ipl_IpfData.Meta.CfgsCustReleaseVersion);
+                ipf->Meta.CfgsCustMajorVersion, ipf->Meta.CfgsCustMinorVersion, ipf->Meta.CfgsCustReleaseVersion);
         }
         else if  (STRINGTYPE_FW == stringType)
         {
             /* If any version is not valid */
-            if ((VERSION_INVALID == Ipl_IpfData.Meta.FwVersionValid) || (VERSION_INVALID == Ipl_InicData.FwVersionValid))
+            if ((VERSION_INVALID == ipf->Meta.FwVersionValid) || (VERSION_INVALID == Ipl_InicData.FwVersionValid))
             {
                 res = IPL_RES_UPDATE_DENIED_UNKNOWN;
                 /* If version in INIC is not valid */
@@ -1312,9 +1804,9 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
             }
             else /* All versions are valid, we can compare them */
             {
-                vipf  =   (uint32_t) ( (uint32_t) Ipl_IpfData.Meta.FwMajorVersion << 16U )
-                        + (uint32_t) ( (uint32_t) Ipl_IpfData.Meta.FwMinorVersion << 8U )
-                        + (uint32_t)  Ipl_IpfData.Meta.FwReleaseVersion;
+                vipf  =   (uint32_t) ( (uint32_t) ipf->Meta.FwMajorVersion << 16U )
+                        + (uint32_t) ( (uint32_t) ipf->Meta.FwMinorVersion << 8U )
+                        + (uint32_t)  ipf->Meta.FwReleaseVersion;
                 vinic =   (uint32_t) ( (uint32_t) Ipl_InicData.FwMajorVersion << 16U )
                         + (uint32_t) ( (uint32_t) Ipl_InicData.FwMinorVersion << 8U )
                         + (uint32_t) Ipl_InicData.FwReleaseVersion;
@@ -1324,11 +1816,11 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
                 }
                 else if (vipf == vinic)
                 {
-                    if (Ipl_IpfData.Meta.FwBuildVersion > Ipl_InicData.FwBuildVersion)
+                    if (ipf->Meta.FwBuildVersion > Ipl_InicData.FwBuildVersion)
                     {
                         res = IPL_RES_OK;
                     }
-                    else if (Ipl_IpfData.Meta.FwBuildVersion == Ipl_InicData.FwBuildVersion)
+                    else if (ipf->Meta.FwBuildVersion == Ipl_InicData.FwBuildVersion)
                     {
                         res = IPL_RES_UPDATE_DENIED_EQUAL;
                     }
@@ -1344,7 +1836,7 @@ static uint8_t Ipl_CheckUpdate(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pData
             }
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckUpdate Firmware INIC: V%u.%u.%u-%u IPF: V%u.%u.%u-%u",
                 Ipl_InicData.FwMajorVersion, Ipl_InicData.FwMinorVersion, Ipl_InicData.FwReleaseVersion, Ipl_InicData.FwBuildVersion,
-                Ipl_IpfData.Meta.FwMajorVersion, Ipl_IpfData.Meta.FwMinorVersion, Ipl_IpfData.Meta.FwReleaseVersion, Ipl_IpfData.Meta.FwBuildVersion);
+                ipf->Meta.FwMajorVersion, ipf->Meta.FwMinorVersion, ipf->Meta.FwReleaseVersion, ipf->Meta.FwBuildVersion);
         }
     }
     Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckUpdate returned 0x%02X", res);
@@ -1359,160 +1851,501 @@ static uint8_t Ipl_CheckIpfOnly(Ipl_IpfData_t *ipf, uint32_t lData, uint8_t pDat
 
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckIpfOnly called with %u byte IPF, StringType 0x%02X", lData, stringType);
     /* Check if correct string is contained in IPF data */
-    res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, stringType);
+    res = Ipl_ParseIpf(ipf, lData, pData, stringType);
     if (IPL_RES_OK == res)
     {
         /* Get IPF versions from metadata */
-        res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, STRINGTYPE_META);
+        res = Ipl_ParseIpf(ipf, lData, pData, STRINGTYPE_META);
         if ((STRINGTYPE_CONFIG == stringType) || (STRINGTYPE_CS == stringType))
         {
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckIpfOnly ConfigString IPF: V%u.%u.%u",
-                Ipl_IpfData.Meta.CfgsCustMajorVersion, Ipl_IpfData.Meta.CfgsCustMinorVersion, Ipl_IpfData.Meta.CfgsCustReleaseVersion);
+                ipf->Meta.CfgsCustMajorVersion, ipf->Meta.CfgsCustMinorVersion, ipf->Meta.CfgsCustReleaseVersion);
         }
         else if  (STRINGTYPE_FW == stringType)
         {
             Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CheckIpfOnly Firmware IPF: V%u.%u.%u-%u",
-                Ipl_IpfData.Meta.FwMajorVersion, Ipl_IpfData.Meta.FwMinorVersion, Ipl_IpfData.Meta.FwReleaseVersion, Ipl_IpfData.Meta.FwBuildVersion);
+                ipf->Meta.FwMajorVersion, ipf->Meta.FwMinorVersion, ipf->Meta.FwReleaseVersion, ipf->Meta.FwBuildVersion);
         }
     }
     Ipl_Trace(Ipl_TraceTag(res), "Ipl_CheckIpfOnly returned 0x%02X", res);
     return res;
 }
-#endif
+#endif
+
+
+/*! \internal Starts up INIC either in boot mode or normal mode. */
+static uint8_t Ipl_StartupInic(uint8_t chipMode, uint8_t probe)
+{
+    uint8_t res = IPL_RES_ERR_HW_INIC_PINS;
+    uint8_t pin;
+    uint8_t boot = (INIC_MODE_BOOT == chipMode) ? IPL_LOW : IPL_HIGH;
+#ifdef IPL_USE_TRANSPORT
+    if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_SETPINS))
+    {
+        /* ERR/BOOT_ only matters when RESET_ is released, so both pins are set in one step */
+        pin = Ipl_TrpSetPins(IPL_LOW, boot);
+    }
+    else
+#endif
+    {
+        pin = Ipl_TrpSetResetPin(IPL_LOW);
+        if (0U == pin)
+        {
+            (void) Ipl_Delay(INIC_PIN_WAIT_TIME);
+            pin = Ipl_TrpSetErrBootPin(boot);
+        }
+    }
+    if (0U == pin)
+    {
+        (void) Ipl_Delay(INIC_PIN_WAIT_TIME);
+        pin = Ipl_TrpSetResetPin(IPL_HIGH);
+        if (0U == pin)
+        {
+            if ((INIC_MODE_BOOT == chipMode) && (IPL_HIGH == probe))
+            {
+                (void) Ipl_ProbeBootloader(INIC_PIN_WAIT_TIME + Ipl_Timing.BootupTime);
+            }
+            else
+            {
+                (void) Ipl_Delay(INIC_PIN_WAIT_TIME);
+                (void) Ipl_Delay(Ipl_Timing.BootupTime);
+            }
+            pin = Ipl_TrpSetErrBootPin(IPL_HIGH);
+            if (0U == pin)
+            {
+                res = IPL_RES_OK;
+            }
+        }
+    }
+    if (IPL_RES_OK == res)
+    {
+        Ipl_IplData.ChipMode = chipMode;
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_StartupInic with mode 0x%02X returned 0x%02X", chipMode, res);
+    return res;
+}
+
+
+/*! \internal Clears RX and TX telegram buffer. */
+void Ipl_ClrTel(void)
+{
+    uint8_t i;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ClrTel");
+    for (i=0U; i<INIC_MAX_TELLEN; i++)
+    {
+        Ipl_IplData.Tel[i] = 0x00U;
+    }
+}
+
+
+/*! \internal Returns the number of data bytes per telegram: Meta.BmMaxDataLength, limited by telegram buffer and transport. */
+uint8_t Ipl_GetDataLen(void)
+{
+    uint16_t len = Ipl_IpfData.Meta.BmMaxDataLength;
+    uint8_t  max = Ipl_TrpMaxTelLen();
+    if ((0U == len) || (DEFAULTVAL_UINT16 == len))
+    {
+        len = INIC_STD_DATALEN; /* IPF without meta data */
+    }
+    if (4U < max)
+    {
+        max -= 4U; /* Command, address and length */
+    }
+    else
+    {
+        max = 1U;
+    }
+    if (len > max)
+    {
+        len = max;
+    }
+    return (uint8_t) len;
+}
+
+
+/*! \internal Returns the number of bytes a read response is longer than with the standard data length. */
+static uint8_t Ipl_GetExtDataLen(void)
+{
+    uint8_t res = 0U;
+    uint8_t len = Ipl_GetDataLen();
+    if (INIC_STD_DATALEN < len)
+    {
+        res = len - INIC_STD_DATALEN;
+    }
+    return res;
+}
+
+
+/*! \internal Waits until the bootloader acknowledges its I2C address or timeout. The time is stored in Ipl_IplData.BootTime. */
+static uint8_t Ipl_ProbeBootloader(uint32_t timeout)
+{
+    uint8_t  rw;
+    uint8_t  probe = 0U;
+    uint32_t wtime = 0U;
+    uint16_t reads = 1U;
+    rw = Ipl_TrpInicRead(1U, &probe);
+    while ((0U != rw) && (wtime < timeout))
+    {
+        wtime += Ipl_Delay(INIC_STARTUP_PROBE_TIME);
+        reads++;
+        rw = Ipl_TrpInicRead(1U, &probe);
+    }
+    if (0U == rw)
+    {
+        Ipl_IplData.BootTime = wtime;
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ProbeBootloader got ACK after %u us (%u reads)", wtime, reads);
+    }
+    else
+    {
+        /* Not reported as error, the following command reports it if INIC is still not ready */
+        Ipl_IplData.BootTime = DEFAULTVAL_UINT32;
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ProbeBootloader timed out after %u us (%u reads)", wtime, reads);
+    }
+    return rw;
+}
+
+
+/*! \internal Waits for some dedicated time or the pulling of the INT pin. */
+static uint8_t Ipl_WaitForResponse(uint8_t cmd)
+{
+    uint8_t res = IPL_RES_OK;
+    int32_t waittime;
+#ifdef IPL_USE_INTPIN
+    int32_t waittime2;
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+    uint32_t elapsed = 0U;
+    uint8_t  done    = IPL_LOW;  /* IPL_HIGH if the completion was detected after elapsed */
+    uint8_t  record  = IPL_HIGH;
+#endif
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForResponse called");
+    waittime = (int32_t) Ipl_GetWaitTime(cmd);
+    if (IPL_HIGH == Ipl_IplData.RxPolled)
+    {
+#ifdef IPL_USE_COMPLETION_POLLING
+        elapsed = (uint32_t) waittime; /* Ipl_InicTransfer() waited this time before reading */
+#endif
+        waittime = 0; /* Response was already read by Ipl_InicTransfer() */
+    }
+    else
+#ifdef IPL_USE_ERASE_POLLING
+    if ((CMD_ERASEPROGMEM == cmd) || (CMD_ERASEINFOMEM == cmd))
+    {
+        res = Ipl_WaitForErase(cmd, (uint32_t) waittime);
+        waittime = 0; /* Erase is completed or timed out, no need to wait any longer */
+#ifdef IPL_USE_COMPLETION_POLLING
+        record = IPL_LOW; /* Recorded by Ipl_WaitForErase() */
+#endif
+    }
+    else
+#endif
+    {
+#ifdef IPL_USE_INTPIN
+        if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_INTPIN))
+        {
+            if ( (int32_t) INIC_INT_WAIT_TIMEOUT > waittime )
+            {
+                waittime2 = (int32_t) INIC_INT_WAIT_TIMEOUT; /*! \internal Case00510681 */
+            }
+            else
+            {
+                waittime2 = waittime; /*! \internal Case00510681 */
+            }
+            res = Ipl_WaitForInt((uint32_t) waittime2); /*! \internal Case00510681 */
+            waittime -= (int32_t) Ipl_IplData.IntTime;
+#ifdef IPL_USE_COMPLETION_POLLING
+            elapsed = Ipl_IplData.IntTime;
+#endif
+        }
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+        if ((IPL_RES_OK == res) && (CMD_WRITEPROGMEM == cmd))
+        {
+            if (0 > waittime)
+            {
+                waittime = 0;
+            }
+            elapsed += Ipl_PollForCompletion(cmd, (uint32_t) waittime);
+            done = Ipl_IplData.RxPolled;
+            waittime = 0;
+        }
+#endif
+    }
+    if (0 < waittime)
+    {
+#ifdef IPL_USE_COMPLETION_POLLING
+        elapsed += Ipl_Delay((uint32_t) waittime);
+#else
+        (void) Ipl_Delay((uint32_t) waittime);
+#endif
+        Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForResponse returned 0x%02X after sleeping for %u us", res, waittime);
+    }
+    else
+    {
+        Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForResponse returned 0x%02X", res);
+    }
+#ifdef IPL_USE_COMPLETION_POLLING
+    if (IPL_HIGH == record)
+    {
+        Ipl_UpdateCmdStat(cmd, elapsed, done);
+    }
+#endif
+    return res;
+}
+
+
+/*! \internal Reads the response from INIC, unless it was already read by completion polling. */
+static uint8_t Ipl_ReadResponse(uint8_t rxlen)
+{
+    uint8_t rw;
+    if (IPL_HIGH == Ipl_IplData.RxPolled)
+    {
+        Ipl_IplData.RxPolled = IPL_LOW; /* Response is already stored in the telegram buffer */
+        rw = Ipl_IplData.RxRes;
+    }
+    else
+    {
+        Ipl_ClrTel();
+        rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+    }
+    return rw;
+}
+
+
+#ifdef IPL_USE_ERASE_POLLING
+/*! \internal Waits until INIC completed an erase command or timeout and indicates the progress meanwhile. */
+static uint8_t Ipl_WaitForErase(uint8_t cmd, uint32_t timeout)
+{
+    uint8_t  res   = IPL_RES_OK;
+    uint8_t  done  = IPL_LOW;
+    uint8_t  wait  = IPL_HIGH;
+    uint32_t wtime = 0U;
+#ifdef IPL_USE_INTPIN
+    uint8_t  pin;
+    uint8_t  intpin = Ipl_TrpHasCap(IPL_TRP_CAP_INTPIN);
+#endif
+    uint8_t  rw;
+    uint8_t  rxlen = Ipl_GetRxLen(cmd);
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForErase called with Command 0x%02X", cmd);
+    Ipl_ProgressIndicator(0U, 0U);
+    while (IPL_HIGH == wait)
+    {
+#ifdef IPL_USE_INTPIN
+        if (IPL_HIGH == intpin)
+        {
+            /* INIC pulls the INT_ pin as soon as the response is available */
+            pin = Ipl_TrpGetIntPin();
+            if (0U == pin)
+            {
+                done = IPL_HIGH;
+            }
+            else if (1U != pin)
+            {
+                res = IPL_RES_ERR_INT_READ;
+            }
+            else if (wtime >= timeout)
+            {
+                res = IPL_RES_ERR_INT_TIMEOUT;
+            }
+        }
+        else
+#endif
+        {
+            /* INIC does not acknowledge the read until the erase is completed */
+            Ipl_ClrTel();
+            rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+            if ((0U == rw) && (0x00U != Ipl_IplData.Tel[0]))
+            {
+                Ipl_IplData.RxPolled = IPL_HIGH;
+                Ipl_IplData.RxRes    = 0U;
+                done = IPL_HIGH;
+            }
+            else if (wtime >= timeout)
+            {
+                wait = IPL_LOW; /* Response is read the regular way, this reports the error */
+            }
+        }
+        if ((IPL_HIGH == done) || (IPL_RES_OK != res))
+        {
+            wait = IPL_LOW;
+        }
+        if (IPL_HIGH == wait)
+        {
+            wtime += Ipl_Delay(INIC_ERASE_POLL_TIME);
+            Ipl_ProgressIndicator((wtime < timeout) ? wtime : timeout, timeout);
+        }
+    }
+    if (IPL_HIGH == done)
+    {
+        Ipl_ProgressIndicator(1U, 1U);
+    }
+#ifdef IPL_USE_COMPLETION_POLLING
+    Ipl_UpdateCmdStat(cmd, wtime, done);
+#endif
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForErase returned 0x%02X after %u us (completed: %u)", res, wtime, done);
+    return res;
+}
+#endif
+
+
+#ifdef IPL_USE_COMPLETION_POLLING
+/*! \internal Retries reading the response with growing backoff until INIC responds or timeout. */
+static uint32_t Ipl_PollForCompletion(uint8_t cmd, uint32_t timeout)
+{
+    uint8_t  rw;
+    uint8_t  rxlen = Ipl_GetRxLen(cmd);
+    uint32_t step  = INIC_POLL_START_TIME;
+    uint32_t wtime = 0U;
+    uint16_t reads = 1U;
+    if (0U != rxlen) /* Unknown commands are reported by Ipl_ExecInicCmd() */
+    {
+        Ipl_ClrTel();
+        rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+        /* Retry until INIC acknowledges the read with a completion code or timeout */
+        while (((0U != rw) || (0x00U == Ipl_IplData.Tel[0])) && (wtime < timeout))
+        {
+            if (step > (timeout - wtime))
+            {
+                step = timeout - wtime;
+            }
+            wtime += Ipl_Delay(step);
+            step = step * 2U;
+            if (INIC_POLL_MAX_STEP_TIME < step)
+            {
+                step = INIC_POLL_MAX_STEP_TIME;
+            }
+            reads++;
+            rw = Ipl_TrpInicRead(rxlen, &Ipl_IplData.Tel[0]);
+        }
+        if ((0U == rw) && (0x00U != Ipl_IplData.Tel[0]))
+        {
+            Ipl_IplData.RxPolled = IPL_HIGH;
+            Ipl_IplData.RxRes    = 0U;
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_PollForCompletion read CC 0x%02X after %u us (%u reads)", Ipl_IplData.Tel[0], wtime, reads);
+        }
+        else
+        {
+            /* Response is read the regular way, this reports the error if INIC still does not respond */
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_PollForCompletion timed out after %u us (%u reads)", wtime, reads);
+        }
+    }
+    return wtime;
+}
+
+
+/*! \internal Clears the collected response times. */
+static void Ipl_ClrCmdStat(void)
+{
+    uint8_t i;
+    for (i=0U; i<INIC_MAX_CMDSTAT; i++)
+    {
+        Ipl_IplData.CmdStat[i].Cmd     = 0x00U;
+        Ipl_IplData.CmdStat[i].Count   = 0U;
+        Ipl_IplData.CmdStat[i].SumTime = 0U;
+        Ipl_IplData.CmdStat[i].MinTime = 0xFFFFFFFFU;
+        Ipl_IplData.CmdStat[i].MaxTime = 0U;
+        Ipl_IplData.CmdStat[i].DoneCount   = 0U;
+        Ipl_IplData.CmdStat[i].DoneMaxTime = 0U;
+    }
+}
 
 
-/*! \internal Starts up INIC either in boot mode or normal mode. */
-static uint8_t Ipl_StartupInic(uint8_t chipMode)
+/*! \internal Adds a response time to the statistics of the referred command, done is IPL_HIGH if its completion was detected. */
+static void Ipl_UpdateCmdStat(uint8_t cmd, uint32_t time, uint8_t done)
 {
-    uint8_t res = IPL_RES_ERR_HW_INIC_PINS;
-    uint8_t pin;
-    pin = Ipl_SetResetPin(IPL_LOW);
-    if (0U == pin)
+    uint8_t i;
+    for (i=0U; i<INIC_MAX_CMDSTAT; i++)
     {
-        Ipl_Sleep(INIC_PIN_WAIT_TIME);
-        if (INIC_MODE_BOOT == chipMode)
+        if ((cmd == Ipl_IplData.CmdStat[i].Cmd) || (0x00U == Ipl_IplData.CmdStat[i].Cmd))
         {
-            pin = Ipl_SetErrBootPin(IPL_LOW);
+            break;
         }
-        else
+    }
+    if (INIC_MAX_CMDSTAT > i) /* Commands that do not fit into the table are not collected */
+    {
+        Ipl_IplData.CmdStat[i].Cmd = cmd;
+        Ipl_IplData.CmdStat[i].Count++;
+        Ipl_IplData.CmdStat[i].SumTime += time;
+        if (time < Ipl_IplData.CmdStat[i].MinTime)
         {
-            pin = Ipl_SetErrBootPin(IPL_HIGH);
+            Ipl_IplData.CmdStat[i].MinTime = time;
         }
-        if (0U == pin)
+        if (time > Ipl_IplData.CmdStat[i].MaxTime)
         {
-            Ipl_Sleep(INIC_PIN_WAIT_TIME);
-            pin = Ipl_SetResetPin(IPL_HIGH);
-            if (0U == pin)
+            Ipl_IplData.CmdStat[i].MaxTime = time;
+        }
+        if (IPL_HIGH == done)
+        {
+            Ipl_IplData.CmdStat[i].DoneCount++;
+            if (time > Ipl_IplData.CmdStat[i].DoneMaxTime)
             {
-                Ipl_Sleep(INIC_PIN_WAIT_TIME);
-                Ipl_Sleep(INIC_BOOTUP_TIME);
-                pin = Ipl_SetErrBootPin(IPL_HIGH);
-                if (0U == pin)
-                {
-                    res = IPL_RES_OK;
-                }
+                Ipl_IplData.CmdStat[i].DoneMaxTime = time;
             }
         }
     }
-    if (IPL_RES_OK == res)
-    {
-        Ipl_IplData.ChipMode = chipMode;
-    }
-    Ipl_Trace(Ipl_TraceTag(res), "Ipl_StartupInic with mode 0x%02X returned 0x%02X", chipMode, res);
-    return res;
 }
 
 
-/*! \internal Clears RX and TX telegram buffer. */
-void Ipl_ClrTel(void)
+/*! \internal Returns the collected response times of the referred command or NULL if not collected. */
+const Ipl_CmdStat_t* Ipl_GetCmdStat(uint8_t cmd)
 {
     uint8_t i;
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ClrTel");
-    for (i=0U; i<INIC_MAX_TELLEN; i++)
+    const Ipl_CmdStat_t* pStat = NULL;
+    for (i=0U; i<INIC_MAX_CMDSTAT; i++)
     {
-        Ipl_IplData.Tel[i] = 0x00U;
+        if ((cmd == Ipl_IplData.CmdStat[i].Cmd) && (0U != Ipl_IplData.CmdStat[i].Count))
+        {
+            pStat = &Ipl_IplData.CmdStat[i];
+            break;
+        }
     }
+    return pStat;
 }
 
 
-/*! \internal Waits for some dedicated time or the pulling of the INT pin. */
-static uint8_t Ipl_WaitForResponse(void)
+/*! \internal Traces the collected response times. */
+static void Ipl_TraceCmdStat(void)
 {
-    uint8_t res = IPL_RES_OK;
-    int32_t waittime;
-#ifdef IPL_USE_INTPIN
-    int32_t waittime2;
-#endif
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForResponse called");
-    switch (Ipl_IplData.Tel[0])
-    {
-        case CMD_WRITEPROGMEM:
-            waittime = (int32_t) INIC_PROGRAM_WAIT_TIME;
-            switch (Ipl_IplData.ChipID) /*! \internal Additional wait time for legacy INICs */
-            {
-                case IPL_CHIP_OS81050:
-                case IPL_CHIP_OS81060:
-                case IPL_CHIP_OS81082:
-                case IPL_CHIP_OS81092:
-                case IPL_CHIP_OS81110:
-                    waittime += (int32_t) INIC_PROGRAM_ADDWAIT_TIME;
-                    break;
-                default:
-                    break;
-            }
-            break;
-        case CMD_ERASEPROGMEM:
-            waittime = (int32_t) INIC_ERASEPROGMEM_WAIT_TIME;
-            break;
-        case CMD_ERASEINFOMEM:
-            waittime = (int32_t) INIC_ERASEINFOMEM_WAIT_TIME;
-            break;
-        default:
-            waittime = (int32_t) INIC_RESP_WAIT_TIME;
-            break;
-    }
-#ifdef IPL_USE_INTPIN
-    if ( (int32_t) INIC_INT_WAIT_TIMEOUT > waittime )
-    {
-        waittime2 = (int32_t) INIC_INT_WAIT_TIMEOUT; /*! \internal Case00510681 */
-    }
-    else
-    {
-        waittime2 = waittime; /*! \internal Case00510681 */
-    }
-    res = Ipl_WaitForInt((uint16_t) waittime2); /*! \internal Case00510681 */
-    waittime -= (int32_t) Ipl_IplData.IntTime;
-#endif
-    if (0 < waittime)
-    {
-        Ipl_Sleep((uint16_t) waittime);
-        Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForResponse returned 0x%02X after sleeping for %u ms", res, waittime);
-    }
-    else
+    uint8_t i;
+    for (i=0U; i<INIC_MAX_CMDSTAT; i++)
     {
-        Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForResponse returned 0x%02X", res);
+        if (0x00U != Ipl_IplData.CmdStat[i].Cmd)
+        {
+            Ipl_Trace(IPL_TRACETAG_INFO, "Command 0x%02X executed %u times, response time min %u us, max %u us, total %u us, %u times completion detected",
+                      Ipl_IplData.CmdStat[i].Cmd, Ipl_IplData.CmdStat[i].Count, Ipl_IplData.CmdStat[i].MinTime,
+                      Ipl_IplData.CmdStat[i].MaxTime, Ipl_IplData.CmdStat[i].SumTime, Ipl_IplData.CmdStat[i].DoneCount);
+        }
     }
-    return res;
 }
+#endif
 
 
 #ifdef IPL_USE_INTPIN
 /*! \internal Waits until INT pin goes low or timeout. */
-static uint8_t Ipl_WaitForInt(uint16_t timeout)
+static uint8_t Ipl_WaitForInt(uint32_t timeout)
 {
     uint8_t  pin;
     uint8_t  res = IPL_RES_OK;
-    uint16_t wtime = 0U;
+    uint32_t wtime = 0U;
     Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForInt called");
-    pin = Ipl_GetIntPin();
-    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForInt - Ipl_GetIntPin returned 0x%02X ", pin);
-    /* Wait until INT goes low or timeout or error */
-    while ((1U == pin) && (wtime < timeout))
-    {
-        Ipl_Sleep(1U);
-        wtime++;
-        pin = Ipl_GetIntPin();
+#ifdef IPL_USE_INTPIN_EDGE
+    if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_INTEDGE))
+    {
+        pin = Ipl_TrpWaitIntEdge(timeout, &wtime);
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForInt - Ipl_WaitIntEdge returned 0x%02X after %u us", pin, wtime);
+    }
+    else
+#endif
+    {
+        pin = Ipl_TrpGetIntPin();
         Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForInt - Ipl_GetIntPin returned 0x%02X ", pin);
+        /* Wait until INT goes low or timeout or error */
+        while ((1U == pin) && (wtime < timeout))
+        {
+            wtime += Ipl_Delay(INIC_INT_POLL_TIME);
+            pin = Ipl_TrpGetIntPin();
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_WaitForInt - Ipl_GetIntPin returned 0x%02X ", pin);
+        }
     }
     switch (pin)
     {
@@ -1527,12 +2360,43 @@ static uint8_t Ipl_WaitForInt(uint16_t timeout)
             break;
     }
     Ipl_IplData.IntTime = wtime;
-    Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForInt returned 0x%02X after %u ms", res, wtime);
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_WaitForInt returned 0x%02X after %u us", res, wtime);
     return res;
 }
 #endif
 
 
+/*! \internal Sleeps the referred time (in us) and returns the time actually slept. */
+static uint32_t Ipl_Delay(uint32_t timeUs)
+{
+    uint32_t timeMs;
+    uint32_t res;
+    uint16_t step;
+#ifdef IPL_USE_SLEEPUS
+    if (IPL_HIGH == Ipl_TrpHasCap(IPL_TRP_CAP_SLEEPUS))
+    {
+        if (0U != timeUs)
+        {
+            Ipl_TrpSleepUs(timeUs);
+        }
+        res = timeUs;
+    }
+    else
+#endif
+    {
+        timeMs = (timeUs + 999U) / 1000U; /* Rounded up, so INIC gets at least the referred time */
+        res    = timeMs * 1000U;
+        while (0U != timeMs)
+        {
+            step = (0xFFFFU < timeMs) ? 0xFFFFU : (uint16_t) timeMs;
+            Ipl_TrpSleep(step);
+            timeMs -= step;
+        }
+    }
+    return res;
+}
+
+
 /*! \internal Calls Progress indicator function when appropriate. */
 void Ipl_ProgressIndicator(uint32_t val, uint32_t fval)
 {
@@ -1582,45 +2446,339 @@ void Ipl_ExportChipInfo(void)
 /* DATA CHUNK HANDLING                                                                            */
 /*------------------------------------------------------------------------------------------------*/
 
+#if IPL_DATACHUNK_SIZE > 0
+/*! \internal Requests the data chunk containing index from the application. */
+static void Ipl_LoadDataChunk(uint32_t index)
+{
+#ifdef IPL_CHUNKCACHE_SLOTS
+    uint8_t  slot;
+    uint8_t* pChunk;
+    uint32_t len;
+#endif
+    Ipl_IplData.ChunkOffset = (index / ( (uint32_t) IPL_DATACHUNK_SIZE ) ) * (uint32_t) IPL_DATACHUNK_SIZE;
+#ifdef IPL_CHUNKCACHE_SLOTS
+    slot = Ipl_FindChunkSlot(Ipl_IplData.ChunkOffset);
+    if (IPL_CHUNKCACHE_SLOTS > slot)
+    {
+        Ipl_IplData.ChunkHits++;
+    }
+    else
+    {
+        Ipl_IplData.ChunkMisses++;
+        slot = Ipl_GetLruChunkSlot();
+#ifdef IPL_USE_STREAMING
+        if (Ipl_IplData.ChunkOffset < Ipl_IplData.ChunkNext)
+        {
+            pChunk = NULL; /* Stream already passed this chunk */
+            Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_LoadDataChunk Offset %u already streamed, next Offset %u",
+                      Ipl_IplData.ChunkOffset, Ipl_IplData.ChunkNext);
+        }
+        else
+#endif
+        {
+            Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_LoadDataChunk requested new DataChunk, Index %u, Offset %u, Size %u, Slot %u",
+                      index, Ipl_IplData.ChunkOffset, IPL_DATACHUNK_SIZE, slot);
+            pChunk = Ipl_RequestDataChunk(Ipl_IplData.ChunkCache[slot].Data);
+#ifdef IPL_USE_STREAMING
+            Ipl_IplData.ChunkNext = Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE;
+#endif
+        }
+        Ipl_IplData.ChunkCache[slot].Valid = IPL_LOW;
+        if (NULL != pChunk)
+        {
+            if (pChunk != Ipl_IplData.ChunkCache[slot].Data)
+            {
+                len = (uint32_t) IPL_DATACHUNK_SIZE;
+                if ((0U != Ipl_IplData.CachedLData) && ((Ipl_IplData.ChunkOffset + len) > Ipl_IplData.CachedLData))
+                {
+                    /* Last chunk, the application only provides the bytes up to the end of the IPF data */
+                    len = (Ipl_IplData.ChunkOffset < Ipl_IplData.CachedLData) ? (Ipl_IplData.CachedLData - Ipl_IplData.ChunkOffset) : 0U;
+                }
+                (void) memcpy(Ipl_IplData.ChunkCache[slot].Data, pChunk, len);
+            }
+            Ipl_IplData.ChunkCache[slot].Offset = Ipl_IplData.ChunkOffset;
+            Ipl_IplData.ChunkCache[slot].Valid  = IPL_HIGH;
+        }
+#ifdef IPL_USE_CHUNK_PREFETCH
+        if (IPL_CHUNKCACHE_SLOTS <= Ipl_FindChunkSlot(Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE))
+        {
+            Ipl_HintDataChunk();
+        }
+#endif
+    }
+    if (IPL_HIGH == Ipl_IplData.ChunkCache[slot].Valid)
+    {
+        Ipl_IplData.ChunkTick++;
+        Ipl_IplData.ChunkCache[slot].LastUse = Ipl_IplData.ChunkTick;
+        Ipl_IplData.pData = Ipl_IplData.ChunkCache[slot].Data;
+    }
+    else
+    {
+        Ipl_IplData.pData = NULL;
+    }
+#else
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_LoadDataChunk requested new DataChunk, Index %u, Offset %u, Size %u",
+              index, Ipl_IplData.ChunkOffset, IPL_DATACHUNK_SIZE);
+    Ipl_IplData.pData = Ipl_RequestDataChunk(NULL);
+#ifdef IPL_USE_CHUNK_PREFETCH
+    /* Data is processed in ascending order, so the following chunk is needed next */
+    Ipl_HintDataChunk();
+#endif
+#endif
+}
+
+
+/*! \internal Returns the chunk at ChunkOffset, from an open IPZ container it is decompressed into dest (NULL: IPZ buffer). */
+static uint8_t* Ipl_RequestDataChunk(uint8_t dest[])
+{
+    uint8_t* res;
+#ifdef IPL_USE_IPZ
+    if (IPL_HIGH == Ipl_IpzIsOpen())
+    {
+        res = Ipl_IpzLoadChunk(Ipl_IplData.ChunkOffset, dest);
+    }
+    else
+#else
+    (void) dest;
+#endif
+    {
+        res = Ipl_ProvideDataChunk(Ipl_IplData.ChunkOffset, (uint32_t) IPL_DATACHUNK_SIZE);
+    }
+    return res;
+}
+
+
+#ifdef IPL_USE_CHUNK_PREFETCH
+/*! \internal Announces the chunk following ChunkOffset to the application. */
+static void Ipl_HintDataChunk(void)
+{
+#ifdef IPL_USE_IPZ
+    if (IPL_HIGH != Ipl_IpzIsOpen()) /* The container is read by IPL itself */
+#endif
+    {
+        Ipl_PrefetchDataChunk(Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE, (uint32_t) IPL_DATACHUNK_SIZE);
+    }
+}
+#endif
+#endif
+
+
+#ifdef IPL_CHUNKCACHE_SLOTS
+/*! \internal Returns the cache slot holding the chunk at offset, IPL_CHUNKCACHE_SLOTS if the chunk is not cached. */
+static uint8_t Ipl_FindChunkSlot(uint32_t offset)
+{
+    uint8_t i;
+    uint8_t res = IPL_CHUNKCACHE_SLOTS;
+    for (i=0U; i<IPL_CHUNKCACHE_SLOTS; i++)
+    {
+        if ((IPL_HIGH == Ipl_IplData.ChunkCache[i].Valid) && (offset == Ipl_IplData.ChunkCache[i].Offset))
+        {
+            res = i;
+            break;
+        }
+    }
+    return res;
+}
+
+
+/*! \internal Returns an unused cache slot or the one used least recently. */
+static uint8_t Ipl_GetLruChunkSlot(void)
+{
+    uint8_t i;
+    uint8_t res = 0U;
+    for (i=0U; i<IPL_CHUNKCACHE_SLOTS; i++)
+    {
+        if (IPL_HIGH != Ipl_IplData.ChunkCache[i].Valid)
+        {
+            res = i;
+            break;
+        }
+        if (Ipl_IplData.ChunkCache[i].LastUse < Ipl_IplData.ChunkCache[res].LastUse)
+        {
+            res = i;
+        }
+    }
+    return res;
+}
+
+
+/*! \internal Drops all cached chunks. */
+static void Ipl_ClrChunkCache(void)
+{
+    uint8_t i;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_ClrChunkCache");
+    for (i=0U; i<IPL_CHUNKCACHE_SLOTS; i++)
+    {
+        Ipl_IplData.ChunkCache[i].Valid   = IPL_LOW;
+        Ipl_IplData.ChunkCache[i].LastUse = 0U;
+    }
+    Ipl_IplData.ChunkTick   = 0U;
+    Ipl_IplData.pCachedData = NULL;
+    Ipl_IplData.CachedLData = 0U;
+    Ipl_IplData.pData       = NULL;
+#ifdef IPL_USE_STREAMING
+    Ipl_IplData.ChunkNext   = 0U;
+#endif
+}
+
+
+/*! \internal Reads the chunk cache statistics. */
+uint8_t Ipl_GetChunkCacheStats(uint32_t* pHits, uint32_t* pMisses)
+{
+    uint8_t res = IPL_RES_ERR_NOT_SUPPORTED;
+    if ((NULL != pHits) && (NULL != pMisses))
+    {
+        *pHits   = Ipl_IplData.ChunkHits;
+        *pMisses = Ipl_IplData.ChunkMisses;
+        res = IPL_RES_OK;
+    }
+    return res;
+}
+#endif
+
+
 /*! \internal Function to refer to a dedicated data position by an application buffer. */
 uint8_t Ipl_PData(uint32_t index, uint32_t lData, uint8_t pData[])
 {
-    uint8_t res;
+    uint8_t res = 0U;
 #if IPL_DATACHUNK_SIZE > 0
-    if ( ( index >= Ipl_IplData.ChunkOffset ) && ( index < ( Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE ) ) )
+    (void) lData;
+    (void) pData;
+    if ( ( NULL == Ipl_IplData.pData ) || ( index < Ipl_IplData.ChunkOffset ) ||
+         ( index >= ( Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE ) ) )
+    {
+        Ipl_LoadDataChunk(index);
+    }
+    if (NULL != Ipl_IplData.pData)
     {
         res = Ipl_IplData.pData[ (index - Ipl_IplData.ChunkOffset) ];
     }
     else
     {
-        Ipl_IplData.ChunkOffset = (index / ( (uint32_t) IPL_DATACHUNK_SIZE ) ) * (uint32_t) IPL_DATACHUNK_SIZE;
-        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_PData requested new DataChunk, Index %u, Offset %u, Size %u",
-                  index, Ipl_IplData.ChunkOffset, IPL_DATACHUNK_SIZE);
-        Ipl_IplData.pData = Ipl_ProvideDataChunk(Ipl_IplData.ChunkOffset, (uint32_t) IPL_DATACHUNK_SIZE);
-        res = Ipl_IplData.pData[index-Ipl_IplData.ChunkOffset];
+        Ipl_IplData.ChunkErr = IPL_HIGH; /* Job fails in Ipl_Prog() */
     }
 #else
+    (void) lData;
     res = pData[index];
 #endif
     return res;
 }
 
 
+/*! \internal Returns a pointer to the data at index, pLen is reduced to the bytes available behind it without a chunk change. */
+uint8_t* Ipl_PDataSpan(uint32_t index, uint32_t* pLen, uint32_t lData, uint8_t pData[])
+{
+    uint8_t* res;
+#if IPL_DATACHUNK_SIZE > 0
+    uint32_t avail;
+    (void) lData;
+    (void) pData;
+    if ( ( NULL == Ipl_IplData.pData ) || ( index < Ipl_IplData.ChunkOffset ) ||
+         ( index >= ( Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE ) ) )
+    {
+        Ipl_LoadDataChunk(index);
+    }
+    if (NULL != Ipl_IplData.pData)
+    {
+        res   = &Ipl_IplData.pData[index - Ipl_IplData.ChunkOffset];
+        avail = ( Ipl_IplData.ChunkOffset + (uint32_t) IPL_DATACHUNK_SIZE ) - index;
+        if (*pLen > avail)
+        {
+            *pLen = avail;
+        }
+    }
+    else
+    {
+        res   = NULL;
+        *pLen = 0U;
+    }
+#else
+    (void) pLen; /* The whole image is available behind index */
+    (void) lData;
+    res = &pData[index];
+#endif
+    return res;
+}
+
+
+/*! \internal Copies len bytes from index on into dest, split only at chunk boundaries. */
+uint8_t Ipl_CopyPData(uint8_t dest[], uint32_t index, uint32_t len, uint32_t lData, uint8_t pData[])
+{
+    uint8_t  res  = IPL_RES_OK;
+    uint32_t done = 0U;
+    uint32_t span;
+    uint8_t* pSrc;
+    while ((done < len) && (IPL_RES_OK == res))
+    {
+        span = len - done;
+        pSrc = Ipl_PDataSpan(index + done, &span, lData, pData);
+        if (NULL != pSrc)
+        {
+            (void) memcpy(&dest[done], pSrc, span);
+            done += span;
+        }
+        else
+        {
+            res = IPL_RES_ERR_INVALID_DATACHUNK;
+        }
+    }
+    return res;
+}
+
+
+#ifdef IPL_USE_HOSTCRC
+/*! \internal Continues the CRC-16/KERMIT over len bytes, the CRC the IPF strings carry in their last two bytes (LSB first). */
+uint16_t Ipl_CalcCrc(uint16_t crc, const uint8_t pBuf[], uint32_t len)
+{
+    uint32_t i;
+    uint8_t  bit;
+    for (i=0U; i<len; i++)
+    {
+        crc ^= (uint16_t) pBuf[i];
+        for (bit=0U; bit<8U; bit++)
+        {
+            if (0U != (crc & 0x0001U))
+            {
+                crc = (uint16_t) ((uint16_t) (crc >> 1U) ^ IPL_CRC_POLY);
+            }
+            else
+            {
+                crc = (uint16_t) (crc >> 1U);
+            }
+        }
+    }
+    return crc;
+}
+#endif
+
+
 /*! \internal Sets buffer back to the first data chunk. */
 uint8_t Ipl_ClrPData(uint32_t lData, uint8_t pData[])
 {
     uint8_t res = IPL_RES_OK;
 #if IPL_DATACHUNK_SIZE > 0
+#ifdef IPL_CHUNKCACHE_SLOTS
+    /* IPL reads from its own slots, so only a different IPF invalidates the cached chunks */
+    if ((pData != Ipl_IplData.pCachedData) || (lData != Ipl_IplData.CachedLData))
+    {
+        Ipl_ClrChunkCache();
+        Ipl_IplData.pCachedData = pData;
+        Ipl_IplData.CachedLData = lData;
+    }
+    if (NULL == Ipl_IplData.pData)
+#else
+    (void) lData;
     if (pData != Ipl_IplData.pData)
+#endif
     {
-        Ipl_IplData.ChunkOffset = 0U;
-        Ipl_IplData.pData       = Ipl_ProvideDataChunk(Ipl_IplData.ChunkOffset, (uint32_t) IPL_DATACHUNK_SIZE);
+        Ipl_LoadDataChunk(0U);
     }
     if (Ipl_IplData.pData == NULL)
     {
         res = IPL_RES_ERR_INVALID_DATACHUNK;
     }
 #else
+    (void) lData;
     if (pData == NULL)
     {
         res = IPL_RES_ERR_INVALID_DATACHUNK;
@@ -1674,6 +2832,36 @@ static void Ipl_TraceCfg(void)
 #ifdef IPL_USE_INTPIN
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_INTPIN defined");
 #endif
+#ifdef IPL_USE_INTPIN_EDGE
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_INTPIN_EDGE defined");
+#endif
+#ifdef IPL_USE_COMPLETION_POLLING
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_COMPLETION_POLLING defined");
+#endif
+#ifdef IPL_USE_ERASE_POLLING
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_ERASE_POLLING defined");
+#endif
+#ifdef IPL_USE_SLEEPUS
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_SLEEPUS defined");
+#endif
+#ifdef IPL_USE_STARTUP_PROBING
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_STARTUP_PROBING defined");
+#endif
+#ifdef IPL_USE_INICTRANSFER
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_INICTRANSFER defined");
+#endif
+#ifdef IPL_USE_INICBATCH
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_INICBATCH defined");
+#endif
+#ifdef IPL_USE_TRANSPORT
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_TRANSPORT defined");
+#endif
+#ifdef IPL_USE_I2CDEV
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_I2CDEV defined");
+#endif
+#ifdef IPL_USE_GPIODEV
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_GPIODEV defined");
+#endif
 #ifdef IPL_INICDRIVER_OPENCLOSE
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_INICDRIVER_OPENCLOSE defined");
 #endif
@@ -1681,6 +2869,28 @@ static void Ipl_TraceCfg(void)
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_PROGRESS_INDICATOR defined");
 #endif
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_DATACHUNK_SIZE = %d", IPL_DATACHUNK_SIZE);
+#ifdef IPL_USE_CHUNK_PREFETCH
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_CHUNK_PREFETCH defined");
+#endif
+#ifdef IPL_CHUNKCACHE_SLOTS
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_CHUNKCACHE_SLOTS = %d", IPL_CHUNKCACHE_SLOTS);
+#endif
+#ifdef IPL_USE_STREAMING
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_STREAMING defined");
+#endif
+#ifdef IPL_USE_IPZ
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_IPZ defined");
+#endif
+#ifdef IPL_USE_IPB
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_IPB defined");
+#endif
+#ifdef IPL_USE_HOSTCRC
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_HOSTCRC defined");
+#endif
+#ifdef IPL_USE_SKIP_IDENTICAL_FW
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_USE_SKIP_IDENTICAL_FW defined");
+#endif
+    Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_MAX_DATALENGTH = %u", IPL_MAX_DATALENGTH);
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_TRACETAG_INFO = '%s'", IPL_TRACETAG_INFO);
     Ipl_Trace(IPL_TRACETAG_INFO, "ipl_cfg.h: IPL_TRACETAG_ERR  = '%s'", IPL_TRACETAG_ERR);
 #ifdef IPL_TRACETAG_IPF
@@ -1713,7 +2923,7 @@ static void Ipl_TraceTel(uint8_t direction)
 {
 #ifdef IPL_TRACETAG_COM
     uint8_t i;
-    char    line [TRACELINE_MAXLEN];
+    char    line [TELTRACE_MAXLEN];
     if (DIR_TX == direction)
     {
         line[0U] = 'T';
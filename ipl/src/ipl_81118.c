@@ -25,6 +25,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include "ipl_cfg.h"
 #include "ipl.h"
 #include "ipf.h"
@@ -42,6 +43,17 @@ static uint8_t OS81118_GetActiveConfigPage(void);
 static uint8_t OS81118_ProgCSIS(uint32_t lData, uint8_t pData[]);
 static uint8_t OS81118_ProgConf(uint32_t lData, uint8_t pData[]);
 static uint8_t OS81118_ProgInfoMem(uint32_t addr, uint32_t nOfBytes, uint8_t pData[]);
+static uint8_t OS81118_GetCrc(uint16_t *pCrc);
+static uint32_t OS81118_GetProgLen(uint32_t addr, uint32_t nOfBytes, uint32_t step);
+static uint8_t OS81118_IsErased(uint8_t cmd, uint32_t addr, uint32_t nOfBytes, uint8_t *pErased);
+static uint8_t OS81118_MeasureErasedWrite(uint8_t cmd, uint32_t addr, uint32_t *pTime);
+#ifdef IPL_USE_HOSTCRC
+static uint8_t OS81118_CheckFirmwareCrc(uint32_t lData, uint8_t pData[], const Ipl_IpfCrc_t **ppCrc);
+static uint8_t OS81118_CheckPageCrc(const Ipl_IpfCrc_t *pCrc, uint32_t addr);
+#endif
+#ifdef IPL_USE_SKIP_IDENTICAL_FW
+static uint8_t OS81118_CompareFirmware(uint32_t lData, uint8_t pData[], const Ipl_IpfCrc_t *pCrc, uint8_t *pSame);
+#endif
 
 
 /*------------------------------------------------------------------------------------------------*/
@@ -60,7 +72,7 @@ uint8_t OS81118_ReadConfigStringVersion(uint32_t lData, uint8_t pData[])
     if (IPL_RES_OK == res)
     {
         /* Check if IPF fits to INIC */
-        res = Ipl_CheckChipId();
+        res = Ipl_CheckChipId(&Ipl_IpfData);
         if (IPL_RES_OK == res)
         {
             addr = ( (uint32_t) Ipl_IpfData.Meta.ChipInfoMemSectionSize * (uint32_t) Ipl_InicData.CfgsActiveConfigPage)
@@ -101,10 +113,16 @@ uint8_t OS81118_ReadConfigStringVersion(uint32_t lData, uint8_t pData[])
 /*! \internal Programs a Firmware. (DUPUG 4.4.1) */
 uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[])
 {
-    uint8_t  res, i;
-    uint32_t addr, len, nOfBytes;
+    uint8_t  res;
+    uint32_t addr, len, nOfBytes, step;
     uint16_t crc;
     uint32_t data = 0U;
+#ifdef IPL_USE_HOSTCRC
+    const Ipl_IpfCrc_t *pCrc = NULL;
+#endif
+#ifdef IPL_USE_SKIP_IDENTICAL_FW
+    uint8_t  same = IPL_LOW;
+#endif
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81118_ProgFirmware called");
     /* Get addresses and sizes from metadata */
     res = Ipl_ParseIpf(&Ipl_IpfData, lData, pData, STRINGTYPE_META);
@@ -115,8 +133,23 @@ uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Check if IPF fits to INIC */
-            res = Ipl_CheckChipId();
+            res = Ipl_CheckChipId(&Ipl_IpfData);
+#ifdef IPL_USE_HOSTCRC
+            if (IPL_RES_OK == res)
+            {
+                /* Check the firmware before anything is erased */
+                res = OS81118_CheckFirmwareCrc(lData, pData, &pCrc);
+            }
+#endif
+#ifdef IPL_USE_SKIP_IDENTICAL_FW
+            if (IPL_RES_OK == res)
+            {
+                res = OS81118_CompareFirmware(lData, pData, pCrc, &same);
+            }
+            if ((IPL_RES_OK == res) && (IPL_HIGH != same))
+#else
             if (IPL_RES_OK == res)
+#endif
             {
                 /* Erase Program Memory */
                 Ipl_ClrTel();
@@ -138,6 +171,7 @@ uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[])
                         Ipl_ClrTel();
                         addr     = Ipl_IpfData.ProgAddr;
                         nOfBytes = Ipl_IpfData.StringSize;
+                        step     = Ipl_GetDataLen();
                         Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
                         Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
                         Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
@@ -147,60 +181,54 @@ uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[])
                             do
                             {
                                 Ipl_ProgressIndicator(Ipl_IpfData.StringSize-nOfBytes, Ipl_IpfData.StringSize);
-                                if (nOfBytes >=  Ipl_IpfData.Meta.BmMaxDataLength)
-                                {
-                                    len       = Ipl_IpfData.Meta.BmMaxDataLength;
-                                    nOfBytes -= Ipl_IpfData.Meta.BmMaxDataLength;
-                                }
-                                else
-                                {
-                                    len      = nOfBytes;
-                                    nOfBytes = 0U;
-                                }
+                                len       = OS81118_GetProgLen(addr, nOfBytes, step);
+                                nOfBytes -= len;
                                 /* Write Program Memory */
                                 Ipl_ClrTel();
                                 Ipl_IplData.Tel[0] = CMD_WRITEPROGMEM;
                                 Ipl_IplData.Tel[1] = (addr >> 8) & 0xFFU;
                                 Ipl_IplData.Tel[2] = addr & 0xFFU;
                                 Ipl_IplData.Tel[3] = len & 0xFFU;
-                                for (i=0U; i<len; i++)
+                                res = Ipl_CopyPData(&Ipl_IplData.Tel[4], Ipl_IpfData.StringOffset+data, len, lData, pData);
+                                Ipl_IplData.TelLen = len + 4U;
+                                if (IPL_RES_OK == res)
                                 {
-                                    Ipl_IplData.Tel[4U+i] = Ipl_PData(i+Ipl_IpfData.StringOffset+data, lData, pData);
+                                    res = Ipl_QueueInicCmd();
                                 }
-                                Ipl_IplData.TelLen = len + 4U;
-                                res = Ipl_ExecInicCmd();
                                 if (0U == nOfBytes)
                                 {
                                     break;
                                 }
-                                addr += Ipl_IpfData.Meta.BmMaxDataLength;
-                                data += Ipl_IpfData.Meta.BmMaxDataLength;
+                                addr += len;
+                                data += len;
                                 if ((0U == (addr % Ipl_IpfData.Meta.ChipPrgMemPageSize)) && (IPL_RES_OK == res))
                                 {
-                                    /* Set Program Memory Page */
-                                    Ipl_ClrTel();
-                                    Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
-                                    Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
-                                    Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
-                                    res = Ipl_ExecInicCmd();
+#ifdef IPL_USE_HOSTCRC
+                                    /* Check the pages written so far */
+                                    res = OS81118_CheckPageCrc(pCrc, addr);
+                                    if (IPL_RES_OK == res)
+#endif
+                                    {
+                                        /* Set Program Memory Page */
+                                        Ipl_ClrTel();
+                                        Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
+                                        Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
+                                        Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
+                                        res = Ipl_QueueInicCmd();
+                                    }
                                 }
                             } while ((nOfBytes != 0U) && (IPL_RES_OK == res));
                             if (IPL_RES_OK == res)
+                            {
+                                res = Ipl_FlushInicCmds();
+                            }
+                            if (IPL_RES_OK == res)
                             {
                                 /* Get CRC */
-                                Ipl_ClrTel();
-                                Ipl_IplData.Tel[0] = CMD_GETCRC;
-                                Ipl_IplData.Tel[3] = 0x02U;
-                                Ipl_IplData.TelLen = CMD_GETCRC_TXLEN;
-                                res = Ipl_ExecInicCmd();
-                                if (IPL_RES_OK == res)
+                                res = OS81118_GetCrc(&crc);
+                                if ((IPL_RES_OK == res) && (crc != 0U))
                                 {
-                                    crc =  (uint16_t) (((uint16_t) Ipl_IplData.Tel[4]) << 8U);
-                                    crc += ((uint16_t) Ipl_IplData.Tel[5]) & 0x00FFU;
-                                    if (crc != 0U)
-                                    {
-                                        res = IPL_RES_ERR_WRONG_CRC;
-                                    }
+                                    res = IPL_RES_ERR_WRONG_CRC;
                                 }
                             }
                         }
@@ -215,6 +243,322 @@ uint8_t OS81118_ProgFirmware(uint32_t lData, uint8_t pData[])
 }
 
 
+/*! \internal Reads the CRC over the data written since CMD_CLEARCRC. */
+static uint8_t OS81118_GetCrc(uint16_t *pCrc)
+{
+    uint8_t res;
+    Ipl_ClrTel();
+    Ipl_IplData.Tel[0] = CMD_GETCRC;
+    Ipl_IplData.Tel[3] = 0x02U;
+    Ipl_IplData.TelLen = CMD_GETCRC_TXLEN;
+    res = Ipl_ExecInicCmd();
+    if (IPL_RES_OK == res)
+    {
+        *pCrc =  (uint16_t) (((uint16_t) Ipl_IplData.Tel[4]) << 8U);
+        *pCrc += ((uint16_t) Ipl_IplData.Tel[5]) & 0x00FFU;
+    }
+    return res;
+}
+
+
+/*! \internal Returns the length of the next program memory telegram, which never crosses the end of a page, as the 16 bit address would wrap. */
+static uint32_t OS81118_GetProgLen(uint32_t addr, uint32_t nOfBytes, uint32_t step)
+{
+    uint32_t len  = (nOfBytes < step) ? nOfBytes : step;
+    uint32_t left = Ipl_IpfData.Meta.ChipPrgMemPageSize - (addr % Ipl_IpfData.Meta.ChipPrgMemPageSize);
+    if (len > left)
+    {
+        len = left;
+    }
+    return len;
+}
+
+
+#ifdef IPL_USE_HOSTCRC
+/*! \internal Checks the FW string with the host calculated CRCs before anything is erased. */
+static uint8_t OS81118_CheckFirmwareCrc(uint32_t lData, uint8_t pData[], const Ipl_IpfCrc_t **ppCrc)
+{
+    uint8_t res = IPL_RES_OK;
+    *ppCrc = Ipl_GetIpfCrc(&Ipl_IpfData, lData, pData, STRINGTYPE_FW);
+    if (NULL == *ppCrc)
+    {
+        res = IPL_RES_ERR_INVALID_DATACHUNK;
+    }
+    else if (0U != (*ppCrc)->Crc)
+    {
+        /* Nothing is erased yet, so the INIC keeps its firmware */
+        Ipl_Trace(IPL_TRACETAG_ERR, "OS81118_CheckFirmwareCrc: FW string does not end with its CRC, residue 0x%04X", (*ppCrc)->Crc);
+        res = IPL_RES_ERR_WRONG_CRC;
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "OS81118_CheckFirmwareCrc returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Compares the CRC of the data written so far with the host calculated CRC, addr is the start of the next page. A mismatch is read once more before programming is stopped. */
+static uint8_t OS81118_CheckPageCrc(const Ipl_IpfCrc_t *pCrc, uint32_t addr)
+{
+    uint8_t  res  = IPL_RES_OK;
+    uint16_t crc  = 0U;
+    uint32_t page = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) - (Ipl_IpfData.ProgAddr / Ipl_IpfData.Meta.ChipPrgMemPageSize) - 1U;
+    if (page < pCrc->NumOfPages)
+    {
+        res = Ipl_FlushInicCmds();
+        if (IPL_RES_OK == res)
+        {
+            res = OS81118_GetCrc(&crc);
+        }
+        if ((IPL_RES_OK == res) && (crc != pCrc->PageCrc[page]))
+        {
+            res = OS81118_GetCrc(&crc); /* A disturbed read must not stop programming */
+            if ((IPL_RES_OK == res) && (crc != pCrc->PageCrc[page]))
+            {
+                res = IPL_RES_ERR_WRONG_CRC;
+            }
+        }
+        Ipl_Trace(Ipl_TraceTag(res), "OS81118_CheckPageCrc returned 0x%02X - Page %u, CRC 0x%04X, host CRC 0x%04X",
+                  res, page, crc, pCrc->PageCrc[page]);
+    }
+    return res;
+}
+#endif
+
+
+#ifdef IPL_USE_SKIP_IDENTICAL_FW
+/*! \internal Compares the firmware in the INIC with the FW string, pSame is IPL_HIGH if the firmware is identical.
+    The CRC reported by CMD_READFWVER is compared first, only if it matches the program memory is read back and compared byte by byte. */
+static uint8_t OS81118_CompareFirmware(uint32_t lData, uint8_t pData[], const Ipl_IpfCrc_t *pCrc, uint8_t *pSame)
+{
+    uint8_t  res      = IPL_RES_OK;
+    uint32_t addr     = Ipl_IpfData.ProgAddr;
+    uint32_t nOfBytes = Ipl_IpfData.StringSize;
+    uint32_t step     = Ipl_GetDataLen();
+    uint32_t done     = 0U;
+    uint32_t len;
+    uint8_t  same     = IPL_HIGH;
+    uint8_t  ref[IPL_MAX_DATALENGTH];
+    Ipl_Trace(IPL_TRACETAG_INFO, "OS81118_CompareFirmware called - INIC CRC 0x%02X, host CRC 0x%04X", Ipl_InicData.FwCrc, pCrc->BodyCrc);
+    /* CMD_READFWVER reports one byte of the FW CRC, so a match still needs to be confirmed */
+    if ((VERSION_VALID != Ipl_InicData.FwVersionValid) || (Ipl_InicData.FwCrc != (pCrc->BodyCrc & 0x00FFU)))
+    {
+        same = IPL_LOW; /* Nothing is read back */
+    }
+    else
+    {
+        Ipl_ClrTel();
+        Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
+        Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
+        Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
+        res = Ipl_ExecInicCmd();
+    }
+    while ((0U != nOfBytes) && (IPL_RES_OK == res) && (IPL_HIGH == same))
+    {
+        len = OS81118_GetProgLen(addr, nOfBytes, step);
+        /* Read Program Memory */
+        Ipl_ClrTel();
+        Ipl_IplData.Tel[0] = CMD_READPROGMEM;
+        Ipl_IplData.Tel[1] = (addr >> 8) & 0xFFU;
+        Ipl_IplData.Tel[2] = addr & 0xFFU;
+        Ipl_IplData.Tel[3] = len & 0xFFU;
+        Ipl_IplData.TelLen = CMD_READPROGMEM_TXLEN;
+        res = Ipl_ExecInicCmd();
+        if (IPL_RES_OK == res)
+        {
+            res = Ipl_CopyPData(ref, Ipl_IpfData.StringOffset + done, len, lData, pData);
+        }
+        if (IPL_RES_OK == res)
+        {
+            if (0 != memcmp(&Ipl_IplData.Tel[4], ref, len))
+            {
+                same = IPL_LOW; /* Stop at the first block that differs */
+            }
+            else
+            {
+                nOfBytes -= len;
+                done     += len;
+                addr     += len;
+                if ((0U == (addr % Ipl_IpfData.Meta.ChipPrgMemPageSize)) && (0U != nOfBytes))
+                {
+                    /* Set Program Memory Page */
+                    Ipl_ClrTel();
+                    Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
+                    Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
+                    Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
+                    res = Ipl_ExecInicCmd();
+                }
+            }
+        }
+    }
+    if (IPL_RES_ERR_INVALID_DATACHUNK == res)
+    {
+        same = IPL_LOW; /* The IPF data is not available, programming fails the same way */
+    }
+    else if (IPL_RES_OK != res)
+    {
+        Ipl_Trace(IPL_TRACETAG_ERR, "OS81118_CompareFirmware read back failed with 0x%02X, firmware is programmed", res);
+        same = IPL_LOW;
+        res  = IPL_RES_OK;
+    }
+    *pSame = same;
+    Ipl_Trace(Ipl_TraceTag(res), "OS81118_CompareFirmware returned 0x%02X - Identical %u, %u bytes equal", res, same, done);
+    return res;
+}
+#endif
+
+
+/*! \internal Measures the program and erase times on memory that reads back erased, so no content is lost.
+ *  Times that cannot be measured this way are set to DEFAULTVAL_UINT32. Writing the info memory takes the
+ *  response wait time, its longest response time is stored in pTime->RespWaitTime if it is longer. */
+uint8_t OS81118_MeasureTiming(Ipl_TimingProfile_t *pTime)
+{
+    uint8_t  res;
+    uint8_t  run;
+    uint8_t  erased = IPL_LOW;
+    uint8_t  step   = Ipl_GetDataLen();
+    uint32_t addr, size, time;
+    uint32_t maxTime = 0U;
+    Ipl_Trace(IPL_TRACETAG_INFO, "OS81118_MeasureTiming called");
+    pTime->ProgramWaitTime      = DEFAULTVAL_UINT32;
+    pTime->EraseProgMemWaitTime = DEFAULTVAL_UINT32;
+    pTime->EraseInfoMemWaitTime = DEFAULTVAL_UINT32;
+    /* No IPF data, the memory layout is taken from the default metadata */
+    Ipl_IpfData.ChipID = Ipl_IplData.ChipID;
+    res = Ipl_SetDefaultMetaProps(&Ipl_IpfData);
+    if (IPL_RES_OK == res)
+    {
+        /* Last program memory section, only the largest firmware uses it */
+        size = Ipl_IpfData.Meta.ChipPrgMemSectionSize;
+        addr = Ipl_IpfData.Meta.ChipPrgMemSize - size;
+        Ipl_ClrTel();
+        Ipl_IplData.Tel[0] = CMD_SETPROGMEMPAGE;
+        Ipl_IplData.Tel[1] = (addr / Ipl_IpfData.Meta.ChipPrgMemPageSize) & 0xFFU;
+        Ipl_IplData.TelLen = CMD_SETPROGMEMPAGE_TXLEN;
+        res = Ipl_ExecInicCmd();
+        if (IPL_RES_OK == res)
+        {
+            res = OS81118_IsErased(CMD_READPROGMEM, addr, size, &erased);
+        }
+        if ((IPL_RES_OK == res) && (IPL_HIGH == erased))
+        {
+            for (run=0U; (run<INIC_CALIB_RUNS) && (IPL_RES_OK == res); run++)
+            {
+                res = OS81118_MeasureErasedWrite(CMD_WRITEPROGMEM, addr + ((uint32_t) run * step), &time);
+                if ((IPL_RES_OK == res) && (time > maxTime))
+                {
+                    maxTime = time;
+                }
+            }
+            if (IPL_RES_OK == res)
+            {
+                pTime->ProgramWaitTime = maxTime;
+                Ipl_ClrTel();
+                Ipl_IplData.Tel[0] = CMD_ERASEPROGMEM;
+                Ipl_IplData.Tel[1] = (addr / size) & 0xFFU;
+                Ipl_IplData.Tel[2] = 1U;
+                Ipl_IplData.TelLen = CMD_ERASEPROGMEM_TXLEN;
+                res = Ipl_MeasureInicCmd(&time);
+            }
+            if (IPL_RES_OK == res)
+            {
+                /* The firmware is erased with one command, it covers all sections behind the bootloader */
+                pTime->EraseProgMemWaitTime = time * ((Ipl_IpfData.Meta.ChipPrgMemSize - Ipl_IpfData.Meta.BmSize) / size);
+            }
+        }
+        else if (IPL_RES_OK == res)
+        {
+            Ipl_Trace(IPL_TRACETAG_ERR, "OS81118_MeasureTiming program memory at 0x%05X is in use, program and erase times are not measured", addr);
+        }
+    }
+    if (IPL_RES_OK == res)
+    {
+        /* Info memory is only erased as a whole */
+        size = (uint32_t) Ipl_IpfData.Meta.ChipNumOfInfoMemSections * Ipl_IpfData.Meta.ChipInfoMemSectionSize;
+        res  = OS81118_IsErased(CMD_READINFOMEM, 0U, size, &erased);
+        if ((IPL_RES_OK == res) && (IPL_HIGH == erased))
+        {
+            maxTime = 0U;
+            for (run=0U; (run<INIC_CALIB_RUNS) && (IPL_RES_OK == res); run++)
+            {
+                res = OS81118_MeasureErasedWrite(CMD_WRITEINFOMEM, (uint32_t) run * step, &time);
+                if ((IPL_RES_OK == res) && (time > maxTime))
+                {
+                    maxTime = time;
+                }
+            }
+            if (IPL_RES_OK == res)
+            {
+                if (maxTime > pTime->RespWaitTime)
+                {
+                    pTime->RespWaitTime = maxTime;
+                }
+                Ipl_ClrTel();
+                Ipl_IplData.Tel[0] = CMD_ERASEINFOMEM;
+                Ipl_IplData.Tel[2] = Ipl_IpfData.Meta.ChipNumOfInfoMemSections;
+                Ipl_IplData.TelLen = CMD_ERASEINFOMEM_TXLEN;
+                res = Ipl_MeasureInicCmd(&time);
+            }
+            if (IPL_RES_OK == res)
+            {
+                pTime->EraseInfoMemWaitTime = time;
+            }
+        }
+        else if (IPL_RES_OK == res)
+        {
+            Ipl_Trace(IPL_TRACETAG_ERR, "OS81118_MeasureTiming info memory is in use, erase time is not measured");
+        }
+    }
+    Ipl_ClrMetaData(&Ipl_IpfData); /* Next job parses the metadata of its IPF data */
+    Ipl_Trace(Ipl_TraceTag(res), "OS81118_MeasureTiming returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Reads the referred program or info memory and reports IPL_HIGH if all of it is erased. */
+static uint8_t OS81118_IsErased(uint8_t cmd, uint32_t addr, uint32_t nOfBytes, uint8_t *pErased)
+{
+    uint8_t  res  = IPL_RES_OK;
+    uint32_t step = Ipl_GetDataLen();
+    uint32_t done = 0U;
+    uint32_t len, i;
+    *pErased = IPL_HIGH;
+    while ((done < nOfBytes) && (IPL_RES_OK == res) && (IPL_HIGH == *pErased))
+    {
+        len = ((nOfBytes - done) < step) ? (nOfBytes - done) : step;
+        Ipl_ClrTel();
+        Ipl_IplData.Tel[0] = cmd;
+        Ipl_IplData.Tel[1] = ((addr + done) >> 8) & 0xFFU;
+        Ipl_IplData.Tel[2] = (addr + done) & 0xFFU;
+        Ipl_IplData.Tel[3] = len & 0xFFU;
+        Ipl_IplData.TelLen = CMD_READPROGMEM_TXLEN; /* Same as CMD_READINFOMEM_TXLEN */
+        res = Ipl_ExecInicCmd();
+        for (i=0U; (i<len) && (IPL_RES_OK == res); i++)
+        {
+            if (0xFFU != Ipl_IplData.Tel[4U + i])
+            {
+                *pErased = IPL_LOW;
+            }
+        }
+        done += len;
+    }
+    return res;
+}
+
+
+/*! \internal Writes 0xFF to erased memory, which keeps it erased, and returns the response time. */
+static uint8_t OS81118_MeasureErasedWrite(uint8_t cmd, uint32_t addr, uint32_t *pTime)
+{
+    uint8_t len = Ipl_GetDataLen();
+    Ipl_ClrTel();
+    Ipl_IplData.Tel[0] = cmd;
+    Ipl_IplData.Tel[1] = (addr >> 8) & 0xFFU;
+    Ipl_IplData.Tel[2] = addr & 0xFFU;
+    Ipl_IplData.Tel[3] = len;
+    (void) memset(&Ipl_IplData.Tel[4], 0xFF, len);
+    Ipl_IplData.TelLen = len + 4U;
+    return Ipl_MeasureInicCmd(pTime);
+}
+
+
 /*! \internal Programs a Configuration (Config or CS+IS). (DUPUG 4.4.4) */
 uint8_t OS81118_ProgConfiguration(uint32_t lData, uint8_t pData[])
 {
@@ -229,7 +573,7 @@ uint8_t OS81118_ProgConfiguration(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81118_ProgConf(lData, pData);
@@ -244,7 +588,7 @@ uint8_t OS81118_ProgConfiguration(uint32_t lData, uint8_t pData[])
                 if (IPL_RES_OK == res)
                 {
                     /* Flashing Conf should only be allowed if Fw version fits */
-                    res = Ipl_CheckInicFwVersion();
+                    res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
                     if (IPL_RES_OK == res)
                     {
                         res = OS81118_ProgCSIS(lData, pData);
@@ -430,18 +774,19 @@ static uint8_t OS81118_ProgCSIS(uint32_t lData, uint8_t pData[])
 /*! \internal Programs Info Memory. (DUPUG 4.4.5) */
 static uint8_t OS81118_ProgInfoMem(uint32_t addr, uint32_t nOfBytes, uint8_t pData[])
 {
-    uint8_t  res, i;
+    uint8_t  res;
     uint32_t len;
     uint32_t data = 0U;
     uint32_t size = nOfBytes;
+    uint32_t step = Ipl_GetDataLen();
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81118_ProgInfoMem called with Addr 0x%04X, NofBytes %u", addr, nOfBytes);
     do
     {
         Ipl_ProgressIndicator(size-nOfBytes, size); /* Update Progress Indicator */
-        if (nOfBytes >= Ipl_IpfData.Meta.BmMaxDataLength)
+        if (nOfBytes >= step)
         {
-            len       = Ipl_IpfData.Meta.BmMaxDataLength;
-            nOfBytes -= Ipl_IpfData.Meta.BmMaxDataLength;
+            len       = step;
+            nOfBytes -= step;
         }
         else
         {
@@ -454,18 +799,18 @@ static uint8_t OS81118_ProgInfoMem(uint32_t addr, uint32_t nOfBytes, uint8_t pDa
         Ipl_IplData.Tel[1] = (addr >> 8) & 0xFFU;
         Ipl_IplData.Tel[2] = addr & 0xFFU;
         Ipl_IplData.Tel[3] = len & 0xFFU;
-        for (i=0U; i<len; i++)
+        res = Ipl_CopyPData(&Ipl_IplData.Tel[4], data+Ipl_IpfData.StringOffset, len, size, pData);
+        Ipl_IplData.TelLen = len + 4U;
+        if (IPL_RES_OK == res)
         {
-            Ipl_IplData.Tel[4U+i] = Ipl_PData(i+data+Ipl_IpfData.StringOffset, size, pData);
+            res = Ipl_ExecInicCmd();
         }
-        Ipl_IplData.TelLen = len + 4U;
-        res = Ipl_ExecInicCmd();
         if (0U == nOfBytes)
         {
             break;
         }
-        addr += Ipl_IpfData.Meta.BmMaxDataLength;
-        data += Ipl_IpfData.Meta.BmMaxDataLength;
+        addr += step;
+        data += step;
     } while ((nOfBytes != 0U) && (IPL_RES_OK == res));
     Ipl_ProgressIndicator(1U, 1U); /* Set Progress Indicator to 100 */
     Ipl_Trace(Ipl_TraceTag(res), "OS81118_ProgInfoMem returned 0x%02X", res);
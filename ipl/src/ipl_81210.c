@@ -62,7 +62,7 @@ uint8_t OS81210_ReadConfigStringVersion(uint32_t lData, uint8_t pData[])
     if (IPL_RES_OK == res)
     {
         /* Check if IPF fits to INIC */
-        res = Ipl_CheckChipId();
+        res = Ipl_CheckChipId(&Ipl_IpfData);
         if (IPL_RES_OK == res)
         {
             addr = Ipl_IpfData.Meta.CfgsOvrlStartAddr; /*! \internal Jira UN-577 */
@@ -193,7 +193,7 @@ uint8_t OS81210_ProgConfigString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -223,7 +223,7 @@ uint8_t OS81210_ProgIdentString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -269,7 +269,7 @@ uint8_t OS81210_ProgTestPatchString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -299,7 +299,7 @@ uint8_t OS81210_ProgTestConfigString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -329,7 +329,7 @@ uint8_t OS81210_ProgTestIdentString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -368,18 +368,19 @@ static uint8_t OS81210_ClearTestMem(void)
 /*! \internal Programs the test memory. (DUPUG 4.5.2) */  /* TBT */
 static uint8_t OS81210_ProgTestMem(uint32_t addr, uint32_t nOfBytes, uint8_t pData[], uint8_t clearData)
 {
-    uint8_t  res, i;
+    uint8_t  res = IPL_RES_OK;
     uint32_t len;
     uint32_t data = 0U;
     uint32_t size = nOfBytes;
+    uint32_t step = Ipl_GetDataLen();
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81210_ProgTestMem called with Addr 0x%04X, nOfBytes %u clearData: %u", addr, nOfBytes, clearData);
     do
     {
         Ipl_ProgressIndicator(size-nOfBytes, size); /* Update Progress Indicator */
-        if (nOfBytes >= Ipl_IpfData.Meta.BmMaxDataLength)
+        if (nOfBytes >= step)
         {
-            len       = Ipl_IpfData.Meta.BmMaxDataLength;
-            nOfBytes -= Ipl_IpfData.Meta.BmMaxDataLength;
+            len       = step;
+            nOfBytes -= step;
         }
         else
         {
@@ -392,25 +393,21 @@ static uint8_t OS81210_ProgTestMem(uint32_t addr, uint32_t nOfBytes, uint8_t pDa
         Ipl_IplData.Tel[1] = (addr >> 8) & 0xFFU;
         Ipl_IplData.Tel[2] = addr & 0xFFU;
         Ipl_IplData.Tel[3] = len & 0xFFU;
-        for (i=0U; i<len; i++)
+        if (TESTMEM_CLEAR != clearData) /* Cleared data is already 0 from Ipl_ClrTel() */
         {
-            if (TESTMEM_CLEAR == clearData)
-            {
-                Ipl_IplData.Tel[4U+i] = 0U;
-            }
-            else
-            {
-                Ipl_IplData.Tel[4U+i] = Ipl_PData(i+data+Ipl_IpfData.StringOffset, (uint32_t) nOfBytes, pData);
-            }
+            res = Ipl_CopyPData(&Ipl_IplData.Tel[4], data+Ipl_IpfData.StringOffset, len, (uint32_t) nOfBytes, pData);
         }
         Ipl_IplData.TelLen = len + 4U;
-        res = Ipl_ExecInicCmd();
+        if (IPL_RES_OK == res)
+        {
+            res = Ipl_ExecInicCmd();
+        }
         if (0U == nOfBytes)
         {
             break;
         }
-        addr += Ipl_IpfData.Meta.BmMaxDataLength;
-        data += Ipl_IpfData.Meta.BmMaxDataLength;
+        addr += step;
+        data += step;
     } while ((nOfBytes != 0U) && (IPL_RES_OK == res));
     Ipl_ProgressIndicator(1U, 1U); /* Set Progress Indicator to 100 */
     Ipl_Trace(Ipl_TraceTag(res), "OS81210_ProgTestMem returned 0x%02X", res);
@@ -432,7 +429,7 @@ uint8_t OS81210_ProgPatchString(uint32_t lData, uint8_t pData[])
         if (IPL_RES_OK == res)
         {
             /* Flashing Conf should only be allowed if Fw version fits */
-            res = Ipl_CheckInicFwVersion();
+            res = Ipl_CheckInicFwVersion(&Ipl_IpfData);
             if (IPL_RES_OK == res)
             {
                 res = OS81210_ClearTestMem();
@@ -491,16 +488,17 @@ static uint8_t OS81210_VerifyPatchString(uint32_t addr, uint32_t nOfBytes, uint8
     uint8_t  data_read[INIC_MAX_PATCHSTRINGSIZE];
     uint32_t data = 0U;
     uint32_t size = nOfBytes;
+    uint32_t step = Ipl_GetDataLen();
     Ipl_Trace(IPL_TRACETAG_INFO, "OS81210_VerifyPatchString called with Addr 0x%04X, nOfBytes %u", addr, nOfBytes);
     if (INIC_MAX_PATCHSTRINGSIZE > nOfBytes)
     {
         do
         {
             Ipl_ProgressIndicator(size-nOfBytes, size); /* Update Progress Indicator */
-            if (nOfBytes >= Ipl_IpfData.Meta.BmMaxDataLength)
+            if (nOfBytes >= step)
             {
-                len       = Ipl_IpfData.Meta.BmMaxDataLength;
-                nOfBytes -= Ipl_IpfData.Meta.BmMaxDataLength;
+                len       = step;
+                nOfBytes -= step;
             }
             else
             {
@@ -524,8 +522,8 @@ static uint8_t OS81210_VerifyPatchString(uint32_t addr, uint32_t nOfBytes, uint8
             {
                 break;
             }
-            addr += Ipl_IpfData.Meta.BmMaxDataLength;
-            data += Ipl_IpfData.Meta.BmMaxDataLength;
+            addr += step;
+            data += step;
         } while ((nOfBytes != 0U) && (IPL_RES_OK == res));
         if (IPL_RES_OK == res)
         {
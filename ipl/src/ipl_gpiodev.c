@@ -0,0 +1,278 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_gpiodev.c
+ *  \brief  Linux GPIO character device transport for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipl_gpiodev.h"
+
+#ifdef IPL_USE_GPIODEV
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/* Bits in struct gpio_v2_line_values refer to the index of the line in the request */
+#define GPIODEV_RESET    0x1U
+#define GPIODEV_BOOT     0x2U
+#define GPIODEV_INT      0x4U
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint8_t Ipl_GpioDevSetResetPin(uint8_t lowHigh);
+static uint8_t Ipl_GpioDevSetErrBootPin(uint8_t lowHigh);
+static uint8_t Ipl_GpioDevSetPins(uint8_t resetLowHigh, uint8_t errBootLowHigh);
+static uint8_t Ipl_GpioDevGetIntPin(void);
+static uint8_t Ipl_GpioDevWaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs);
+static uint8_t Ipl_GpioDevSetValues(uint64_t mask, uint64_t bits);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static int Ipl_GpioDevFd    = -1;
+static int Ipl_GpioDevErrno = 0;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION IMPLEMENTATIONS                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \internal Requests the lines and fills in the transport. */
+uint8_t Ipl_GpioDevOpen(Ipl_Transport_t* pTransport, const char* pChip, uint32_t resetLine, uint32_t bootLine, uint32_t intLine)
+{
+    uint8_t res = IPL_RES_ERR_HW_INIC_PINS;
+    int     chip;
+    struct gpio_v2_line_request req;
+    if ((NULL != pTransport) && (NULL != pChip))
+    {
+        (void) Ipl_GpioDevClose();
+        (void) memset(&req, 0, sizeof(req));
+        (void) strncpy(req.consumer, "ipl", sizeof(req.consumer) - 1U);
+        req.offsets[0] = resetLine;
+        req.offsets[1] = bootLine;
+        req.num_lines  = 2U;
+        req.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+        /* Both pins are released until IPL starts INIC */
+        req.config.attrs[0].attr.id     = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        req.config.attrs[0].attr.values = GPIODEV_RESET | GPIODEV_BOOT;
+        req.config.attrs[0].mask        = GPIODEV_RESET | GPIODEV_BOOT;
+        req.config.num_attrs = 1U;
+        if (IPL_GPIODEV_NOLINE != intLine)
+        {
+            req.offsets[2] = intLine;
+            req.num_lines  = 3U;
+            req.config.attrs[1].attr.id    = GPIO_V2_LINE_ATTR_ID_FLAGS;
+            req.config.attrs[1].attr.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+            req.config.attrs[1].mask       = GPIODEV_INT;
+            req.config.num_attrs = 2U;
+        }
+        chip = open(pChip, O_RDONLY | O_CLOEXEC);
+        if (0 > chip)
+        {
+            Ipl_GpioDevErrno = errno;
+        }
+        else
+        {
+            if (0 > ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &req))
+            {
+                Ipl_GpioDevErrno = errno;
+            }
+            else
+            {
+                /* Lines stay requested as long as req.fd is open */
+                Ipl_GpioDevFd    = req.fd;
+                Ipl_GpioDevErrno = 0;
+                pTransport->SetResetPin   = Ipl_GpioDevSetResetPin;
+                pTransport->SetErrBootPin = Ipl_GpioDevSetErrBootPin;
+                pTransport->SetPins       = Ipl_GpioDevSetPins;
+                pTransport->Caps         |= IPL_TRP_CAP_SETPINS;
+                if (IPL_GPIODEV_NOLINE != intLine)
+                {
+                    pTransport->GetIntPin   = Ipl_GpioDevGetIntPin;
+                    pTransport->WaitIntEdge = Ipl_GpioDevWaitIntEdge;
+                    pTransport->Caps       |= (uint8_t) (IPL_TRP_CAP_INTPIN | IPL_TRP_CAP_INTEDGE);
+                }
+                else
+                {
+                    pTransport->Caps &= (uint8_t) ~(IPL_TRP_CAP_INTPIN | IPL_TRP_CAP_INTEDGE);
+                }
+                res = IPL_RES_OK;
+            }
+            (void) close(chip);
+        }
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_GpioDevOpen returned 0x%02X (errno %d)", res, Ipl_GpioDevErrno);
+    return res;
+}
+
+
+/*! \internal Releases the lines. */
+uint8_t Ipl_GpioDevClose(void)
+{
+    uint8_t res = IPL_RES_ERR_HW_INIC_PINS;
+    if (0 <= Ipl_GpioDevFd)
+    {
+        (void) close(Ipl_GpioDevFd);
+        Ipl_GpioDevFd = -1;
+        res = IPL_RES_OK;
+    }
+    return res;
+}
+
+
+/*! \internal Returns the errno of the last failed GPIO access. */
+int Ipl_GpioDevGetErrno(void)
+{
+    return Ipl_GpioDevErrno;
+}
+
+
+/*! \internal Sets INIC's RESET_ pin. */
+static uint8_t Ipl_GpioDevSetResetPin(uint8_t lowHigh)
+{
+    return Ipl_GpioDevSetValues(GPIODEV_RESET, (0U != lowHigh) ? GPIODEV_RESET : 0U);
+}
+
+
+/*! \internal Sets INIC's ERR/BOOT_ pin. */
+static uint8_t Ipl_GpioDevSetErrBootPin(uint8_t lowHigh)
+{
+    return Ipl_GpioDevSetValues(GPIODEV_BOOT, (0U != lowHigh) ? GPIODEV_BOOT : 0U);
+}
+
+
+/*! \internal Sets INIC's RESET_ and ERR/BOOT_ pin at the same time. */
+static uint8_t Ipl_GpioDevSetPins(uint8_t resetLowHigh, uint8_t errBootLowHigh)
+{
+    uint64_t bits = 0U;
+    if (0U != resetLowHigh)
+    {
+        bits |= GPIODEV_RESET;
+    }
+    if (0U != errBootLowHigh)
+    {
+        bits |= GPIODEV_BOOT;
+    }
+    return Ipl_GpioDevSetValues(GPIODEV_RESET | GPIODEV_BOOT, bits);
+}
+
+
+/*! \internal Reads INIC's INT_ pin. */
+static uint8_t Ipl_GpioDevGetIntPin(void)
+{
+    uint8_t res = 2U;
+    struct gpio_v2_line_values values;
+    values.mask = GPIODEV_INT;
+    values.bits = 0U;
+    if (0 > ioctl(Ipl_GpioDevFd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values))
+    {
+        Ipl_GpioDevErrno = errno;
+    }
+    else
+    {
+        res = (0U != (values.bits & GPIODEV_INT)) ? 1U : 0U;
+    }
+    return res;
+}
+
+
+/*! \internal Waits until INIC's INT_ pin goes LOW or timeout. */
+static uint8_t Ipl_GpioDevWaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs)
+{
+    uint8_t  res = 2U;
+    int      rc;
+    struct gpio_v2_line_event event;
+    struct pollfd   pfd;
+    struct timespec start, stop;
+    *pElapsedUs = 0U;
+    (void) clock_gettime(CLOCK_MONOTONIC, &start);
+    pfd.fd     = Ipl_GpioDevFd;
+    pfd.events = POLLIN;
+    /* Discard edges of former commands, then check the level in case INT_ is already low */
+    rc = poll(&pfd, 1U, 0);
+    while ((0 < rc) && ((ssize_t) sizeof(event) == read(Ipl_GpioDevFd, &event, sizeof(event))))
+    {
+        rc = poll(&pfd, 1U, 0);
+    }
+    if (0 == rc)
+    {
+        res = Ipl_GpioDevGetIntPin();
+    }
+    if (1U == res)
+    {
+        rc = poll(&pfd, 1U, (int) ((timeoutUs + 999U) / 1000U)); /* Rounded up to ms */
+        (void) clock_gettime(CLOCK_MONOTONIC, &stop);
+        *pElapsedUs = (uint32_t) (((stop.tv_sec - start.tv_sec) * 1000000L) + ((stop.tv_nsec - start.tv_nsec) / 1000L));
+        if ((0 < rc) && ((ssize_t) sizeof(event) == read(Ipl_GpioDevFd, &event, sizeof(event))))
+        {
+            res = 0U;
+        }
+        else if (0 != rc)
+        {
+            res = 2U;
+        }
+    }
+    if (2U == res)
+    {
+        Ipl_GpioDevErrno = errno;
+    }
+    return res;
+}
+
+
+/*! \internal Sets the referred lines with one ioctl. */
+static uint8_t Ipl_GpioDevSetValues(uint64_t mask, uint64_t bits)
+{
+    uint8_t res = 0U;
+    struct gpio_v2_line_values values;
+    values.mask = mask;
+    values.bits = bits;
+    if (0 > ioctl(Ipl_GpioDevFd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values))
+    {
+        Ipl_GpioDevErrno = errno;
+        res = 1U;
+    }
+    return res;
+}
+
+#endif
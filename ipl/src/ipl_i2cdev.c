@@ -0,0 +1,334 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_i2cdev.c
+ *  \brief  Linux i2c-dev transport for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipl_i2cdev.h"
+
+#ifdef IPL_USE_I2CDEV
+
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define I2CDEV_MAX_MSGS  42U  /* I2C_RDWR_IOCTL_MAX_MSGS of i2c-dev */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint8_t Ipl_I2cDevRead(uint8_t lData, uint8_t* pData);
+static uint8_t Ipl_I2cDevWrite(uint8_t lData, uint8_t* pData);
+static uint8_t Ipl_I2cDevTransfer(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs);
+static uint8_t Ipl_I2cDevTransferBatch(uint8_t num, Ipl_Telegram_t tel[]);
+static uint8_t Ipl_I2cDevExecTel(Ipl_Telegram_t* pTel);
+static void    Ipl_I2cDevSleep(uint16_t timeMs);
+static void    Ipl_I2cDevSleepUs(uint32_t timeUs);
+static uint8_t Ipl_I2cDevRdWr(struct i2c_msg msgs[], uint8_t num);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static int      Ipl_I2cDevFd    = -1;
+static uint16_t Ipl_I2cDevAddr  = 0U;
+static int      Ipl_I2cDevErrno = 0;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION IMPLEMENTATIONS                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \internal Opens the I2C device and fills in the transport. */
+uint8_t Ipl_I2cDevOpen(Ipl_Transport_t* pTransport, const char* pDevice, uint8_t address)
+{
+    uint8_t       res = IPL_RES_ERR_HW_INIC_COM;
+    unsigned long funcs = 0U;
+    if ((NULL != pTransport) && (NULL != pDevice))
+    {
+        (void) Ipl_I2cDevClose();
+        Ipl_I2cDevFd = open(pDevice, O_RDWR | O_CLOEXEC);
+        if (0 > Ipl_I2cDevFd)
+        {
+            Ipl_I2cDevErrno = errno;
+        }
+        else if ((0 > ioctl(Ipl_I2cDevFd, I2C_FUNCS, &funcs)) || (0 > ioctl(Ipl_I2cDevFd, I2C_SLAVE, (unsigned long) address)))
+        {
+            Ipl_I2cDevErrno = errno;
+            (void) close(Ipl_I2cDevFd);
+            Ipl_I2cDevFd = -1;
+        }
+        else
+        {
+            Ipl_I2cDevAddr  = address;
+            Ipl_I2cDevErrno = 0;
+            pTransport->InicRead  = Ipl_I2cDevRead;
+            pTransport->InicWrite = Ipl_I2cDevWrite;
+            pTransport->Sleep     = Ipl_I2cDevSleep;
+            pTransport->SleepUs   = Ipl_I2cDevSleepUs;
+            pTransport->Caps     |= IPL_TRP_CAP_SLEEPUS;
+            if (0U != (funcs & I2C_FUNC_I2C))
+            {
+                /* Adapter supports plain I2C messages, so write and read can be combined with I2C_RDWR */
+                pTransport->InicTransfer      = Ipl_I2cDevTransfer;
+                pTransport->InicTransferBatch = Ipl_I2cDevTransferBatch;
+                pTransport->Caps             |= (uint8_t) (IPL_TRP_CAP_TRANSFER | IPL_TRP_CAP_BATCH);
+            }
+            else
+            {
+                pTransport->Caps &= (uint8_t) ~(IPL_TRP_CAP_TRANSFER | IPL_TRP_CAP_BATCH);
+            }
+            res = IPL_RES_OK;
+        }
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_I2cDevOpen returned 0x%02X (functionality 0x%08lX, errno %d)", res, funcs, Ipl_I2cDevErrno);
+    return res;
+}
+
+
+/*! \internal Closes the I2C device. */
+uint8_t Ipl_I2cDevClose(void)
+{
+    uint8_t res = IPL_RES_ERR_HW_INIC_COM;
+    if (0 <= Ipl_I2cDevFd)
+    {
+        (void) close(Ipl_I2cDevFd);
+        Ipl_I2cDevFd = -1;
+        res = IPL_RES_OK;
+    }
+    return res;
+}
+
+
+/*! \internal Returns the errno of the last failed I2C access. */
+int Ipl_I2cDevGetErrno(void)
+{
+    return Ipl_I2cDevErrno;
+}
+
+
+/*! \internal Reads a telegram from INIC. */
+static uint8_t Ipl_I2cDevRead(uint8_t lData, uint8_t* pData)
+{
+    uint8_t res = 1U;
+    if ((ssize_t) lData == read(Ipl_I2cDevFd, pData, lData))
+    {
+        res = 0U;
+    }
+    else
+    {
+        Ipl_I2cDevErrno = errno;
+    }
+    return res;
+}
+
+
+/*! \internal Sends a telegram to INIC. */
+static uint8_t Ipl_I2cDevWrite(uint8_t lData, uint8_t* pData)
+{
+    uint8_t res = 1U;
+    if ((ssize_t) lData == write(Ipl_I2cDevFd, pData, lData))
+    {
+        res = 0U;
+    }
+    else
+    {
+        Ipl_I2cDevErrno = errno;
+    }
+    return res;
+}
+
+
+/*! \internal Sends a telegram and reads the response, with a repeated start if no delay is needed. */
+static uint8_t Ipl_I2cDevTransfer(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs)
+{
+    uint8_t res = 1U;
+    struct i2c_msg msgs[2];
+    if (0U != delayUs)
+    {
+        /* i2c-dev cannot wait between the messages of one transfer */
+        if (0U == Ipl_I2cDevWrite(txLen, pTx))
+        {
+            Ipl_I2cDevSleepUs(delayUs);
+            res = (0U == Ipl_I2cDevRead(rxLen, pRx)) ? 0U : 2U;
+        }
+    }
+    else
+    {
+        msgs[0].addr  = Ipl_I2cDevAddr;
+        msgs[0].flags = 0U;
+        msgs[0].len   = txLen;
+        msgs[0].buf   = pTx;
+        msgs[1].addr  = Ipl_I2cDevAddr;
+        msgs[1].flags = I2C_M_RD;
+        msgs[1].len   = rxLen;
+        msgs[1].buf   = pRx;
+        res = Ipl_I2cDevRdWr(msgs, 2U);
+    }
+    return res;
+}
+
+
+/*! \internal Executes the telegrams, all following telegrams without delay and polling are combined into one I2C_RDWR. */
+static uint8_t Ipl_I2cDevTransferBatch(uint8_t num, Ipl_Telegram_t tel[])
+{
+    struct i2c_msg msgs[I2CDEV_MAX_MSGS];
+    uint8_t i = 0U;
+    uint8_t k;
+    uint8_t run;
+    uint8_t stop = 0U;
+    while ((i < num) && (0U == stop))
+    {
+        if ((0U != tel[i].DelayUs) || (0U != tel[i].PollUs))
+        {
+            tel[i].Res = Ipl_I2cDevExecTel(&tel[i]);
+            stop = tel[i].Res;
+            i++;
+        }
+        else
+        {
+            run = 0U;
+            while (((i + run) < num) && (0U == tel[i + run].DelayUs) && (0U == tel[i + run].PollUs) &&
+                   ((2U * (run + 1U)) <= I2CDEV_MAX_MSGS))
+            {
+                msgs[2U * run].addr       = Ipl_I2cDevAddr;
+                msgs[2U * run].flags      = 0U;
+                msgs[2U * run].len        = tel[i + run].TxLen;
+                msgs[2U * run].buf        = tel[i + run].Tx;
+                msgs[2U * run + 1U].addr  = Ipl_I2cDevAddr;
+                msgs[2U * run + 1U].flags = I2C_M_RD;
+                msgs[2U * run + 1U].len   = tel[i + run].RxLen;
+                msgs[2U * run + 1U].buf   = tel[i + run].Rx;
+                run++;
+            }
+            stop = Ipl_I2cDevRdWr(msgs, 2U * run);
+            if (0U != stop)
+            {
+                /* The kernel does not report which message failed, so the first telegram is blamed */
+                tel[i].Res = 1U;
+                i++;
+            }
+            else
+            {
+                for (k = 0U; k < run; k++)
+                {
+                    tel[i + k].Res    = 0U;
+                    tel[i + k].TimeUs = 0U;
+                }
+                i += run;
+            }
+        }
+    }
+    return i;
+}
+
+
+/*! \internal Sends a telegram and reads the response after DelayUs, or polls it with growing steps up to DelayUs if PollUs is not 0. */
+static uint8_t Ipl_I2cDevExecTel(Ipl_Telegram_t* pTel)
+{
+    uint8_t  res  = 1U;
+    uint32_t step = pTel->PollUs;
+    pTel->TimeUs = 0U;
+    if (0U == Ipl_I2cDevWrite(pTel->TxLen, pTel->Tx))
+    {
+        if (0U == step)
+        {
+            Ipl_I2cDevSleepUs(pTel->DelayUs);
+            pTel->TimeUs = pTel->DelayUs;
+        }
+        res = (0U == Ipl_I2cDevRead(pTel->RxLen, pTel->Rx)) ? 0U : 2U;
+        /* INIC does not acknowledge the read until the command is completed */
+        while ((0U != step) && ((0U != res) || (0x00U == pTel->Rx[0])) && (pTel->TimeUs < pTel->DelayUs))
+        {
+            if (step > (pTel->DelayUs - pTel->TimeUs))
+            {
+                step = pTel->DelayUs - pTel->TimeUs;
+            }
+            Ipl_I2cDevSleepUs(step);
+            pTel->TimeUs += step;
+            step = step * 2U;
+            if (INIC_POLL_MAX_STEP_TIME < step)
+            {
+                step = INIC_POLL_MAX_STEP_TIME;
+            }
+            res = (0U == Ipl_I2cDevRead(pTel->RxLen, pTel->Rx)) ? 0U : 2U;
+        }
+    }
+    return res;
+}
+
+
+/*! \internal Performs one combined transfer. Returns 0 on success, 1 if no message and 2 if only some messages were done. */
+static uint8_t Ipl_I2cDevRdWr(struct i2c_msg msgs[], uint8_t num)
+{
+    uint8_t res = 0U;
+    int     n;
+    struct i2c_rdwr_ioctl_data xfer;
+    xfer.msgs  = msgs;
+    xfer.nmsgs = num;
+    n = ioctl(Ipl_I2cDevFd, I2C_RDWR, &xfer);
+    if ((int) num != n)
+    {
+        Ipl_I2cDevErrno = errno;
+        res = (0 < n) ? 2U : 1U;
+    }
+    return res;
+}
+
+
+/*! \internal Sleeps some milliseconds. */
+static void Ipl_I2cDevSleep(uint16_t timeMs)
+{
+    Ipl_I2cDevSleepUs((uint32_t) timeMs * 1000U);
+}
+
+
+/*! \internal Sleeps some microseconds, also if a signal interrupts the sleep. */
+static void Ipl_I2cDevSleepUs(uint32_t timeUs)
+{
+    struct timespec ts;
+    ts.tv_sec  = (time_t) (timeUs / 1000000U);
+    ts.tv_nsec = (long) (timeUs % 1000000U) * 1000L;
+    while (EINTR == clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts))
+    {
+    }
+}
+
+#endif
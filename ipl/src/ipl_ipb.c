@@ -0,0 +1,146 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_ipb.c
+ *  \brief  Multi-chip IPF bundle (IPB) for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipf.h"
+#include "ipl_ipb.h"
+
+#ifdef IPL_USE_IPB
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint32_t Ipl_IpbGet32(const uint8_t pIpb[], uint32_t index);
+static uint8_t  Ipl_IpbMatch(uint8_t filter, uint8_t value);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION IMPLEMENTATIONS                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \internal Looks up the members of the ChipID in the chip table and returns the first one fitting to the filter. */
+uint8_t Ipl_IpbSelect(const uint8_t pIpb[], uint32_t lIpb, Ipl_IpbMember_t* pMember)
+{
+    uint8_t  res = IPL_RES_ERR_IPF_INVALID;
+    uint8_t  chip;
+    uint32_t num;
+    uint32_t first;
+    uint32_t count;
+    uint32_t i;
+    uint32_t e;
+    uint32_t offset;
+    uint32_t len;
+    if ((NULL != pIpb) && (NULL != pMember) && (IPB_HEADER_LEN <= lIpb) &&
+        ('I' == pIpb[0]) && ('P' == pIpb[1]) && ('B' == pIpb[2]) && (IPB_VERSION == pIpb[3]))
+    {
+        num = Ipl_IpbGet32(pIpb, 8U);
+        if ((Ipl_IpbGet32(pIpb, 4U) == lIpb) && (0U < num) && (255U >= num) && (IPB_INDEX_LEN(num) <= lIpb))
+        {
+            chip = pMember->ChipID;
+            if (IPB_ANY == chip)
+            {
+                chip = Ipl_InicData.ChipID; /* Read by Ipl_EnterProgMode() */
+            }
+            first = pIpb[16U + (2U * (uint32_t) chip)];
+            count = pIpb[17U + (2U * (uint32_t) chip)];
+            if (DEFAULTVAL_UINT8 == chip)
+            {
+                res = IPL_RES_ERR_NOVALIDCHIPID;
+            }
+            else if ((first + count) <= num)
+            {
+                res = IPL_RES_ERR_IPF_WRONGINIC;
+                for (i=first; i<(first + count); i++) /* Only the members of this ChipID */
+                {
+                    e      = IPB_HEADER_LEN + (i * IPB_ENTRY_LEN);
+                    offset = Ipl_IpbGet32(pIpb, e + 8U);
+                    len    = Ipl_IpbGet32(pIpb, e + 12U);
+                    if ((chip != pIpb[e]) || (offset < IPB_INDEX_LEN(num)) || (offset > lIpb) || (len > (lIpb - offset)))
+                    {
+                        res = IPL_RES_ERR_IPF_INVALID;
+                        break;
+                    }
+                    if ((IPL_HIGH == Ipl_IpbMatch(pMember->FwMajorVersion,         pIpb[e + 1U])) &&
+                        (IPL_HIGH == Ipl_IpbMatch(pMember->FwMinorVersion,         pIpb[e + 2U])) &&
+                        (IPL_HIGH == Ipl_IpbMatch(pMember->FwReleaseVersion,       pIpb[e + 3U])) &&
+                        (IPL_HIGH == Ipl_IpbMatch(pMember->CfgsCustMajorVersion,   pIpb[e + 4U])) &&
+                        (IPL_HIGH == Ipl_IpbMatch(pMember->CfgsCustMinorVersion,   pIpb[e + 5U])) &&
+                        (IPL_HIGH == Ipl_IpbMatch(pMember->CfgsCustReleaseVersion, pIpb[e + 6U])))
+                    {
+                        pMember->ChipID                 = chip;
+                        pMember->FwMajorVersion         = pIpb[e + 1U];
+                        pMember->FwMinorVersion         = pIpb[e + 2U];
+                        pMember->FwReleaseVersion       = pIpb[e + 3U];
+                        pMember->CfgsCustMajorVersion   = pIpb[e + 4U];
+                        pMember->CfgsCustMinorVersion   = pIpb[e + 5U];
+                        pMember->CfgsCustReleaseVersion = pIpb[e + 6U];
+                        pMember->Offset                 = offset;
+                        pMember->Length                 = len;
+                        res = IPL_RES_OK;
+                        break;
+                    }
+                }
+            }
+            Ipl_Trace(Ipl_TraceTag(res), "Ipl_IpbSelect ChipID 0x%02X has %u of %u members", chip, count, num);
+        }
+    }
+    if (IPL_RES_OK == res)
+    {
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_IpbSelect FW V%u.%u.%u, CFGS V%u.%u.%u, %u bytes at offset %u",
+                  pMember->FwMajorVersion, pMember->FwMinorVersion, pMember->FwReleaseVersion,
+                  pMember->CfgsCustMajorVersion, pMember->CfgsCustMinorVersion, pMember->CfgsCustReleaseVersion,
+                  pMember->Length, pMember->Offset);
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_IpbSelect returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Returns IPL_HIGH if the value fits to the filter, IPB_ANY fits always. */
+static uint8_t Ipl_IpbMatch(uint8_t filter, uint8_t value)
+{
+    return ((IPB_ANY == filter) || (filter == value)) ? IPL_HIGH : IPL_LOW;
+}
+
+
+/*! \internal Returns the big endian value at index of the bundle. */
+static uint32_t Ipl_IpbGet32(const uint8_t pIpb[], uint32_t index)
+{
+    uint32_t res;
+    res  = (uint32_t) pIpb[index]      << 24U;
+    res += (uint32_t) pIpb[index + 1U] << 16U;
+    res += (uint32_t) pIpb[index + 2U] <<  8U;
+    res += (uint32_t) pIpb[index + 3U];
+    return res;
+}
+
+#endif
@@ -0,0 +1,261 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_ipz.c
+ *  \brief  Compressed IPF container (IPZ) for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipl_ipz.h"
+
+#ifdef IPL_USE_IPZ
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define IPZ_MINMATCH    4U    /* Shortest match of the LZ4 block format */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint32_t Ipl_IpzGet32(uint32_t index);
+static uint8_t  Ipl_IpzInflate(const uint8_t src[], uint32_t lSrc, uint8_t dest[], uint32_t lDest);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static const uint8_t* Ipl_IpzData   = NULL;   /* Open container, NULL if none */
+static uint32_t       Ipl_IpzLen    = 0U;     /* Length of the container */
+static uint32_t       Ipl_IpzLData  = 0U;     /* Length of the original IPF data */
+static uint32_t       Ipl_IpzBlocks = 0U;     /* Number of blocks */
+static uint8_t        Ipl_IpzChunk[IPL_DATACHUNK_SIZE]; /* Decompressed chunk if IPL has no buffer of its own */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION IMPLEMENTATIONS                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \internal Checks the container header and block index and keeps the container open. */
+uint8_t Ipl_IpzOpen(const uint8_t pIpz[], uint32_t lIpz, uint32_t* pLData)
+{
+    uint8_t  res = IPL_RES_ERR_IPF_INVALID;
+    uint32_t i;
+    uint32_t first;
+    uint32_t prev;
+    uint32_t next;
+    (void) Ipl_IpzClose();
+    if ((NULL != pIpz) && (NULL != pLData) && (IPZ_HEADER_LEN <= lIpz) &&
+        ('I' == pIpz[0]) && ('P' == pIpz[1]) && ('Z' == pIpz[2]) && (IPZ_VERSION == pIpz[3]))
+    {
+        Ipl_IpzData   = pIpz;
+        Ipl_IpzLen    = lIpz;
+        Ipl_IpzLData  = Ipl_IpzGet32(4U);
+        Ipl_IpzBlocks = Ipl_IpzGet32(12U);
+        if ((Ipl_IpzGet32(8U) == (uint32_t) IPL_DATACHUNK_SIZE) && (0U < Ipl_IpzLData) &&
+            (Ipl_IpzBlocks == (((Ipl_IpzLData - 1U) / (uint32_t) IPL_DATACHUNK_SIZE) + 1U)) &&
+            (Ipl_IpzBlocks < ((lIpz - IPZ_HEADER_LEN) / 4U)))
+        {
+            first = IPZ_HEADER_LEN + ((Ipl_IpzBlocks + 1U) * 4U);
+            prev  = first;
+            res   = IPL_RES_OK;
+            for (i=0U; i<=Ipl_IpzBlocks; i++) /* Blocks are in ascending order and inside the container */
+            {
+                next = Ipl_IpzGet32(IPZ_HEADER_LEN + (i * 4U));
+                if ((next < prev) || (next > lIpz) || ((0U == i) && (next != first)) ||
+                    ((i == Ipl_IpzBlocks) && (next != lIpz)))
+                {
+                    res = IPL_RES_ERR_IPF_INVALID;
+                    break;
+                }
+                prev = next;
+            }
+        }
+        if (IPL_RES_OK == res)
+        {
+            *pLData = Ipl_IpzLData;
+        }
+        else
+        {
+            Ipl_IpzData = NULL;
+        }
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_IpzOpen returned 0x%02X, %u bytes in %u blocks, IPF %u bytes",
+              res, lIpz, Ipl_IpzBlocks, Ipl_IpzLData);
+    return res;
+}
+
+
+/*! \internal Closes the container. */
+uint8_t Ipl_IpzClose(void)
+{
+    uint8_t res = IPL_RES_ERR_NOT_SUPPORTED;
+    if (NULL != Ipl_IpzData)
+    {
+        Ipl_IpzData = NULL;
+        res = IPL_RES_OK;
+    }
+    Ipl_IpzLen    = 0U;
+    Ipl_IpzLData  = 0U;
+    Ipl_IpzBlocks = 0U;
+    return res;
+}
+
+
+/*! \internal Returns IPL_HIGH if a container is open. */
+uint8_t Ipl_IpzIsOpen(void)
+{
+    return (NULL != Ipl_IpzData) ? IPL_HIGH : IPL_LOW;
+}
+
+
+/*! \internal Decompresses the chunk starting at sIndex into dest (own buffer if NULL). Returns NULL on error. */
+uint8_t* Ipl_IpzLoadChunk(uint32_t sIndex, uint8_t dest[])
+{
+    uint8_t* res   = NULL;
+    uint8_t* pDest = (NULL != dest) ? dest : Ipl_IpzChunk;
+    uint32_t block = sIndex / (uint32_t) IPL_DATACHUNK_SIZE;
+    uint32_t start;
+    uint32_t lSrc;
+    uint32_t lDest;
+    if ((NULL != Ipl_IpzData) && (block < Ipl_IpzBlocks))
+    {
+        start = Ipl_IpzGet32(IPZ_HEADER_LEN + (block * 4U));
+        lSrc  = Ipl_IpzGet32(IPZ_HEADER_LEN + ((block + 1U) * 4U)) - start;
+        lDest = Ipl_IpzLData - (block * (uint32_t) IPL_DATACHUNK_SIZE);
+        if (lDest > (uint32_t) IPL_DATACHUNK_SIZE)
+        {
+            lDest = (uint32_t) IPL_DATACHUNK_SIZE;
+        }
+        if (lSrc == lDest)
+        {
+            (void) memcpy(pDest, &Ipl_IpzData[start], lDest); /* Stored block */
+            res = pDest;
+        }
+        else if (IPL_RES_OK == Ipl_IpzInflate(&Ipl_IpzData[start], lSrc, pDest, lDest))
+        {
+            res = pDest;
+        }
+        else
+        {
+            Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_IpzLoadChunk Block %u corrupt", block);
+        }
+        if ((NULL != res) && (lDest < (uint32_t) IPL_DATACHUNK_SIZE))
+        {
+            (void) memset(&pDest[lDest], 0, (uint32_t) IPL_DATACHUNK_SIZE - lDest);
+        }
+    }
+    return res;
+}
+
+
+/*! \internal Returns the big endian value at index of the container. */
+static uint32_t Ipl_IpzGet32(uint32_t index)
+{
+    uint32_t res;
+    res  = (uint32_t) Ipl_IpzData[index]      << 24U;
+    res += (uint32_t) Ipl_IpzData[index + 1U] << 16U;
+    res += (uint32_t) Ipl_IpzData[index + 2U] <<  8U;
+    res += (uint32_t) Ipl_IpzData[index + 3U];
+    return res;
+}
+
+
+/*! \internal Decompresses an LZ4 block, every length and offset is checked against both buffers. */
+static uint8_t Ipl_IpzInflate(const uint8_t src[], uint32_t lSrc, uint8_t dest[], uint32_t lDest)
+{
+    uint8_t  res = IPL_RES_OK;
+    uint32_t s   = 0U;
+    uint32_t d   = 0U;
+    uint32_t len;
+    uint32_t dist;
+    uint32_t i;
+    uint8_t  token;
+    uint8_t  ext;
+    while ((IPL_RES_OK == res) && (s < lSrc))
+    {
+        token = src[s];
+        s++;
+        len = (uint32_t) token >> 4U;
+        ext = (15U == len) ? 255U : 0U;
+        while ((255U == ext) && (s < lSrc))
+        {
+            ext  = src[s];
+            len += ext;
+            s++;
+        }
+        if ((255U == ext) || (len > (lSrc - s)) || (len > (lDest - d)))
+        {
+            res = IPL_RES_ERR_IPF_INVALID;
+            break;
+        }
+        (void) memcpy(&dest[d], &src[s], len);
+        s += len;
+        d += len;
+        if (s == lSrc)
+        {
+            break; /* Last sequence only has literals */
+        }
+        if (2U > (lSrc - s))
+        {
+            res = IPL_RES_ERR_IPF_INVALID;
+            break;
+        }
+        dist = (uint32_t) src[s] + ((uint32_t) src[s + 1U] << 8U);
+        s += 2U;
+        len = ((uint32_t) token & 0x0FU) + IPZ_MINMATCH;
+        ext = (15U == ((uint32_t) token & 0x0FU)) ? 255U : 0U;
+        while ((255U == ext) && (s < lSrc))
+        {
+            ext  = src[s];
+            len += ext;
+            s++;
+        }
+        if ((255U == ext) || (0U == dist) || (dist > d) || (len > (lDest - d)))
+        {
+            res = IPL_RES_ERR_IPF_INVALID;
+            break;
+        }
+        for (i=0U; i<len; i++) /* Byte by byte, the match may overlap the bytes it produces */
+        {
+            dest[d] = dest[d - dist];
+            d++;
+        }
+    }
+    if (d != lDest)
+    {
+        res = IPL_RES_ERR_IPF_INVALID;
+    }
+    return res;
+}
+
+#endif
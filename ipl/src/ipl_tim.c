@@ -0,0 +1,258 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_tim.c
+ *  \brief  Internal timing profile functions for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipf.h"
+#include "ipl_pb.h"
+#include "ipl_tim.h"
+#include "ipl_81118.h"
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define TIM_CHIPNUM 11U /* Number of INICs with a timing profile */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* TYPES                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+
+typedef struct Ipl_TimEntry_
+{
+    uint8_t             ChipID;   /*!< \internal INIC identifier                                   */
+    Ipl_TimingProfile_t Profile;  /*!< \internal Default timing profile                            */
+} Ipl_TimEntry_t;
+
+
+typedef struct Ipl_TimCustom_
+{
+    uint8_t             Valid;    /*!< \internal IPL_HIGH if the profile was set by the application */
+    Ipl_TimingProfile_t Profile;  /*!< \internal Timing profile set by application or calibration  */
+} Ipl_TimCustom_t;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION PROTOTYPES                                                                            */
+/*------------------------------------------------------------------------------------------------*/
+
+static uint8_t  Ipl_TimIndex(uint8_t chipID);
+static uint32_t Ipl_TimTune(uint32_t measured, uint32_t time);
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static const Ipl_TimEntry_t Ipl_TimDefault[TIM_CHIPNUM] =
+{
+    /* INICnet technology, program time is the datasheet worst case */
+    { IPL_CHIP_OS81118, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81119, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81210, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81212, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81214, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81216, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    /* Legacy INICs need additional program time */
+    { IPL_CHIP_OS81110, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME + INIC_PROGRAM_ADDWAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81092, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME + INIC_PROGRAM_ADDWAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81082, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME + INIC_PROGRAM_ADDWAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81060, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME + INIC_PROGRAM_ADDWAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } },
+    { IPL_CHIP_OS81050, { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME + INIC_PROGRAM_ADDWAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME } }
+};
+
+static Ipl_TimCustom_t Ipl_TimCustom[TIM_CHIPNUM]; /* Zero initialized, so no custom profile is valid */
+
+Ipl_TimingProfile_t Ipl_Timing = { INIC_RESP_WAIT_TIME, INIC_PROGRAM_WAIT_TIME, INIC_ERASEPROGMEM_WAIT_TIME, INIC_ERASEINFOMEM_WAIT_TIME, INIC_BOOTUP_TIME };
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \internal Replaces the timing profile of the referred INIC or restores its default profile. */
+uint8_t Ipl_SetTimingProfile(uint8_t chipID, const Ipl_TimingProfile_t* pProfile)
+{
+    uint8_t res = IPL_RES_ERR_NOT_SUPPORTED;
+    uint8_t i = Ipl_TimIndex(chipID);
+    if (TIM_CHIPNUM > i)
+    {
+        if (NULL == pProfile)
+        {
+            Ipl_TimCustom[i].Valid = IPL_LOW;
+        }
+        else
+        {
+            Ipl_TimCustom[i].Profile = *pProfile;
+            Ipl_TimCustom[i].Valid   = IPL_HIGH;
+        }
+        if (chipID == Ipl_IplData.ChipID)
+        {
+            Ipl_LoadTimingProfile(chipID);
+        }
+        res = IPL_RES_OK;
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_SetTimingProfile for ChipID 0x%02X returned 0x%02X", chipID, res);
+    return res;
+}
+
+
+/*! \internal Reads the timing profile of the referred INIC. */
+uint8_t Ipl_GetTimingProfile(uint8_t chipID, Ipl_TimingProfile_t* pProfile)
+{
+    uint8_t res = IPL_RES_ERR_NOT_SUPPORTED;
+    uint8_t i = Ipl_TimIndex(chipID);
+    if ((TIM_CHIPNUM > i) && (NULL != pProfile))
+    {
+        if (IPL_HIGH == Ipl_TimCustom[i].Valid)
+        {
+            *pProfile = Ipl_TimCustom[i].Profile;
+        }
+        else
+        {
+            *pProfile = Ipl_TimDefault[i].Profile;
+        }
+        res = IPL_RES_OK;
+    }
+    return res;
+}
+
+
+/*! \internal Activates the timing profile of the referred INIC. Unknown INICs keep the default timing. */
+void Ipl_LoadTimingProfile(uint8_t chipID)
+{
+    (void) Ipl_GetTimingProfile(chipID, &Ipl_Timing);
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_LoadTimingProfile resp %u us, program %u us, erase prog mem %u us, erase info mem %u us, bootup %u us",
+              Ipl_Timing.RespWaitTime, Ipl_Timing.ProgramWaitTime, Ipl_Timing.EraseProgMemWaitTime,
+              Ipl_Timing.EraseInfoMemWaitTime, Ipl_Timing.BootupTime);
+}
+
+
+/*! \internal Measures the wait times of the connected INIC with its own probes and activates the tuned profile. */
+uint8_t Ipl_CalibrateTiming(void)
+{
+    uint8_t  res = IPL_RES_ERR_NOT_SUPPORTED;
+    uint8_t  i, run;
+    uint32_t boot, resp;
+    Ipl_TimingProfile_t meas;  /* Longest measured times, DEFAULTVAL_UINT32 if not measured */
+    Ipl_TimingProfile_t tuned;
+    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CalibrateTiming called");
+    i = Ipl_TimIndex(Ipl_IplData.ChipID);
+    if (TIM_CHIPNUM > i)
+    {
+        /* Probes time out after the default times, a previous calibration does not limit them */
+        Ipl_Timing = Ipl_TimDefault[i].Profile;
+        tuned      = Ipl_Timing;
+        meas.RespWaitTime         = 0U;
+        meas.BootupTime           = 0U;
+        meas.ProgramWaitTime      = DEFAULTVAL_UINT32;
+        meas.EraseProgMemWaitTime = DEFAULTVAL_UINT32;
+        meas.EraseInfoMemWaitTime = DEFAULTVAL_UINT32;
+        res = IPL_RES_OK;
+        for (run=0U; (run<INIC_CALIB_RUNS) && (IPL_RES_OK == res); run++)
+        {
+            /* Each run resets INIC, INIC is in programming mode afterwards */
+            res = Ipl_MeasureStartup(&boot, &resp);
+            if ((IPL_RES_OK == res) && (DEFAULTVAL_UINT32 == boot))
+            {
+                res = IPL_RES_ERR_HW_INIC_COM; /* Bootloader did not acknowledge within the default time */
+            }
+            if (IPL_RES_OK == res)
+            {
+                meas.BootupTime   = (boot > meas.BootupTime) ? boot : meas.BootupTime;
+                meas.RespWaitTime = (resp > meas.RespWaitTime) ? resp : meas.RespWaitTime;
+            }
+        }
+        if (IPL_RES_OK == res)
+        {
+            switch (Ipl_IplData.ChipID)
+            {
+#if defined IPL_USE_OS81118 || defined IPL_USE_OS81119
+                case IPL_CHIP_OS81118:
+                case IPL_CHIP_OS81119:
+                    res = OS81118_MeasureTiming(&meas);
+                    break;
+#endif
+                case IPL_CHIP_OS81210:
+                case IPL_CHIP_OS81212:
+                case IPL_CHIP_OS81214:
+                case IPL_CHIP_OS81216:
+                    Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_CalibrateTiming program and erase times are not used by OTP INICs");
+                    break;
+                default:
+                    Ipl_Trace(IPL_TRACETAG_ERR, "Ipl_CalibrateTiming program and erase times are not measured for ChipID 0x%02X", Ipl_IplData.ChipID);
+                    break;
+            }
+        }
+        if (IPL_RES_OK == res)
+        {
+            tuned.RespWaitTime         = Ipl_TimTune(meas.RespWaitTime, tuned.RespWaitTime);
+            tuned.ProgramWaitTime      = Ipl_TimTune(meas.ProgramWaitTime, tuned.ProgramWaitTime);
+            tuned.EraseProgMemWaitTime = Ipl_TimTune(meas.EraseProgMemWaitTime, tuned.EraseProgMemWaitTime);
+            tuned.EraseInfoMemWaitTime = Ipl_TimTune(meas.EraseInfoMemWaitTime, tuned.EraseInfoMemWaitTime);
+            /* Without probing the bootup time is slept after INIC_PIN_WAIT_TIME, which is part of the measured time */
+            tuned.BootupTime = Ipl_TimTune(meas.BootupTime, tuned.BootupTime);
+            tuned.BootupTime = (INIC_PIN_WAIT_TIME < tuned.BootupTime) ? (tuned.BootupTime - INIC_PIN_WAIT_TIME) : 0U;
+            Ipl_TimCustom[i].Profile = tuned;
+            Ipl_TimCustom[i].Valid   = IPL_HIGH;
+        }
+        Ipl_LoadTimingProfile(Ipl_IplData.ChipID); /* Previous profile is kept if the calibration failed */
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_CalibrateTiming returned 0x%02X", res);
+    return res;
+}
+
+
+/*! \internal Returns the index of the referred INIC in the timing tables or TIM_CHIPNUM if unknown. */
+static uint8_t Ipl_TimIndex(uint8_t chipID)
+{
+    uint8_t i;
+    for (i=0U; i<TIM_CHIPNUM; i++)
+    {
+        if (chipID == Ipl_TimDefault[i].ChipID)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+
+/*! \internal Derives the wait time from the longest measured time plus 25% margin, keeps the time if it was not measured. */
+static uint32_t Ipl_TimTune(uint32_t measured, uint32_t time)
+{
+    uint32_t res = time;
+    if (DEFAULTVAL_UINT32 != measured)
+    {
+        res = measured + (measured / 4U) + INIC_CALIB_MARGIN_TIME;
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_TimTune measured max %u us, tuned %u us (default %u us)", measured, res, time);
+    }
+    return res;
+}
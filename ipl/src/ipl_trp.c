@@ -0,0 +1,321 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipl_trp.c
+ *  \brief  Internal transport functions for INIC Programming Library
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipl_trp.h"
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifdef IPL_USE_INICTRANSFER
+#define TRP_CFG_TRANSFER IPL_TRP_CAP_TRANSFER
+#else
+#define TRP_CFG_TRANSFER 0U
+#endif
+#ifdef IPL_USE_INICBATCH
+#define TRP_CFG_BATCH    IPL_TRP_CAP_BATCH
+#else
+#define TRP_CFG_BATCH    0U
+#endif
+#ifdef IPL_USE_SLEEPUS
+#define TRP_CFG_SLEEPUS  IPL_TRP_CAP_SLEEPUS
+#else
+#define TRP_CFG_SLEEPUS  0U
+#endif
+#ifdef IPL_USE_INTPIN
+#define TRP_CFG_INTPIN   IPL_TRP_CAP_INTPIN
+#else
+#define TRP_CFG_INTPIN   0U
+#endif
+#ifdef IPL_USE_INTPIN_EDGE
+#define TRP_CFG_INTEDGE  IPL_TRP_CAP_INTEDGE
+#else
+#define TRP_CFG_INTEDGE  0U
+#endif
+
+#ifdef IPL_USE_TRANSPORT
+#define TRP_CFG_SETPINS  IPL_TRP_CAP_SETPINS /* No callback without transport */
+#else
+#define TRP_CFG_SETPINS  0U
+#endif
+
+/* Capabilities enabled in ipl_cfg.h */
+#define TRP_CFG_CAPS     (TRP_CFG_TRANSFER | TRP_CFG_BATCH | TRP_CFG_SLEEPUS | TRP_CFG_INTPIN | TRP_CFG_INTEDGE | TRP_CFG_SETPINS)
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifdef IPL_USE_TRANSPORT
+static const Ipl_Transport_t* Ipl_Trp = NULL;
+#endif
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTION IMPLEMENTATIONS                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifdef IPL_USE_TRANSPORT
+/*! \internal Registers the transport used for all hardware accesses. */
+uint8_t Ipl_SetTransport(const Ipl_Transport_t* pTransport)
+{
+    uint8_t res = IPL_RES_ERR_INVALID_TRANSPORT;
+    if ((NULL != pTransport) && (NULL != pTransport->SetResetPin) && (NULL != pTransport->SetErrBootPin) &&
+        (NULL != pTransport->InicRead) && (NULL != pTransport->InicWrite) && (NULL != pTransport->Sleep))
+    {
+        res = IPL_RES_OK;
+        if (((0U != (pTransport->Caps & IPL_TRP_CAP_TRANSFER)) && (NULL == pTransport->InicTransfer)) ||
+            ((0U != (pTransport->Caps & IPL_TRP_CAP_BATCH))    && (NULL == pTransport->InicTransferBatch)) ||
+            ((0U != (pTransport->Caps & IPL_TRP_CAP_SLEEPUS))  && (NULL == pTransport->SleepUs)) ||
+            ((0U != (pTransport->Caps & IPL_TRP_CAP_INTPIN))   && (NULL == pTransport->GetIntPin)) ||
+            ((0U != (pTransport->Caps & IPL_TRP_CAP_INTEDGE))  && (NULL == pTransport->WaitIntEdge)) ||
+            ((0U != (pTransport->Caps & IPL_TRP_CAP_SETPINS))  && (NULL == pTransport->SetPins)))
+        {
+            res = IPL_RES_ERR_INVALID_TRANSPORT;
+        }
+    }
+    if (IPL_RES_OK == res)
+    {
+        Ipl_Trp = pTransport;
+        Ipl_Trace(IPL_TRACETAG_INFO, "Ipl_SetTransport registered transport with capabilities 0x%02X (used: 0x%02X)",
+                  pTransport->Caps, pTransport->Caps & TRP_CFG_CAPS);
+    }
+    Ipl_Trace(Ipl_TraceTag(res), "Ipl_SetTransport returned 0x%02X", res);
+    return res;
+}
+#endif
+
+
+/*! \internal Returns IPL_HIGH if a transport is available. */
+uint8_t Ipl_TrpIsValid(void)
+{
+    uint8_t res = IPL_HIGH;
+#ifdef IPL_USE_TRANSPORT
+    if (NULL == Ipl_Trp)
+    {
+        res = IPL_LOW;
+    }
+#endif
+    return res;
+}
+
+
+/*! \internal Returns IPL_HIGH if the referred capability is enabled in ipl_cfg.h and supported by the transport. */
+uint8_t Ipl_TrpHasCap(uint8_t cap)
+{
+    uint8_t caps = TRP_CFG_CAPS;
+#ifdef IPL_USE_TRANSPORT
+    caps = (NULL != Ipl_Trp) ? (Ipl_Trp->Caps & caps) : 0U;
+#endif
+    return (cap == (caps & cap)) ? IPL_HIGH : IPL_LOW;
+}
+
+
+/*! \internal Returns the length of the longest telegram the transport can send. */
+uint8_t Ipl_TrpMaxTelLen(void)
+{
+    uint8_t res = INIC_MAX_TELLEN;
+#ifdef IPL_USE_TRANSPORT
+    if ((NULL != Ipl_Trp) && (0U != Ipl_Trp->MaxTelLen) && (INIC_MAX_TELLEN > Ipl_Trp->MaxTelLen))
+    {
+        res = Ipl_Trp->MaxTelLen;
+    }
+#endif
+    return res;
+}
+
+
+/*! \internal Sets INIC's RESET_ pin. */
+uint8_t Ipl_TrpSetResetPin(uint8_t lowHigh)
+{
+#ifdef IPL_USE_TRANSPORT
+    return (NULL != Ipl_Trp) ? Ipl_Trp->SetResetPin(lowHigh) : 1U;
+#else
+    return Ipl_SetResetPin(lowHigh);
+#endif
+}
+
+
+/*! \internal Sets INIC's ERR/BOOT_ pin. */
+uint8_t Ipl_TrpSetErrBootPin(uint8_t lowHigh)
+{
+#ifdef IPL_USE_TRANSPORT
+    return (NULL != Ipl_Trp) ? Ipl_Trp->SetErrBootPin(lowHigh) : 1U;
+#else
+    return Ipl_SetErrBootPin(lowHigh);
+#endif
+}
+
+
+#ifdef IPL_USE_TRANSPORT
+/*! \internal Sets INIC's RESET_ and ERR/BOOT_ pin at the same time. Only called if IPL_TRP_CAP_SETPINS is available. */
+uint8_t Ipl_TrpSetPins(uint8_t resetLowHigh, uint8_t errBootLowHigh)
+{
+    return Ipl_Trp->SetPins(resetLowHigh, errBootLowHigh);
+}
+#endif
+
+
+/*! \internal Reads a telegram from INIC. */
+uint8_t Ipl_TrpInicRead(uint8_t lData, uint8_t* pData)
+{
+#ifdef IPL_USE_TRANSPORT
+    return (NULL != Ipl_Trp) ? Ipl_Trp->InicRead(lData, pData) : 1U;
+#else
+    return Ipl_InicRead(lData, pData);
+#endif
+}
+
+
+/*! \internal Sends a telegram to INIC. */
+uint8_t Ipl_TrpInicWrite(uint8_t lData, uint8_t* pData)
+{
+#ifdef IPL_USE_TRANSPORT
+    return (NULL != Ipl_Trp) ? Ipl_Trp->InicWrite(lData, pData) : 1U;
+#else
+    return Ipl_InicWrite(lData, pData);
+#endif
+}
+
+
+/*! \internal Sleeps some milliseconds. */
+void Ipl_TrpSleep(uint16_t timeMs)
+{
+#ifdef IPL_USE_TRANSPORT
+    if (NULL != Ipl_Trp)
+    {
+        Ipl_Trp->Sleep(timeMs);
+    }
+#else
+    Ipl_Sleep(timeMs);
+#endif
+}
+
+
+#ifdef IPL_USE_SLEEPUS
+/*! \internal Sleeps some microseconds. Only called if IPL_TRP_CAP_SLEEPUS is available. */
+void Ipl_TrpSleepUs(uint32_t timeUs)
+{
+#ifdef IPL_USE_TRANSPORT
+    Ipl_Trp->SleepUs(timeUs);
+#else
+    Ipl_SleepUs(timeUs);
+#endif
+}
+#endif
+
+
+#ifdef IPL_USE_INTPIN
+/*! \internal Reads INIC's INT_ pin. Only called if IPL_TRP_CAP_INTPIN is available. */
+uint8_t Ipl_TrpGetIntPin(void)
+{
+#ifdef IPL_USE_TRANSPORT
+    return Ipl_Trp->GetIntPin();
+#else
+    return Ipl_GetIntPin();
+#endif
+}
+#endif
+
+
+#ifdef IPL_USE_INTPIN_EDGE
+/*! \internal Waits until INIC's INT_ pin goes LOW. Only called if IPL_TRP_CAP_INTEDGE is available. */
+uint8_t Ipl_TrpWaitIntEdge(uint32_t timeoutUs, uint32_t* pElapsedUs)
+{
+#ifdef IPL_USE_TRANSPORT
+    return Ipl_Trp->WaitIntEdge(timeoutUs, pElapsedUs);
+#else
+    return Ipl_WaitIntEdge(timeoutUs, pElapsedUs);
+#endif
+}
+#endif
+
+
+#ifdef IPL_USE_INICTRANSFER
+/*! \internal Sends a telegram and reads the response. Only called if IPL_TRP_CAP_TRANSFER is available. */
+uint8_t Ipl_TrpInicTransfer(uint8_t txLen, uint8_t* pTx, uint8_t rxLen, uint8_t* pRx, uint32_t delayUs)
+{
+#ifdef IPL_USE_TRANSPORT
+    return Ipl_Trp->InicTransfer(txLen, pTx, rxLen, pRx, delayUs);
+#else
+    return Ipl_InicTransfer(txLen, pTx, rxLen, pRx, delayUs);
+#endif
+}
+#endif
+
+
+#ifdef IPL_USE_INICBATCH
+/*! \internal Executes several telegrams. Only called if IPL_TRP_CAP_BATCH is available. */
+uint8_t Ipl_TrpInicTransferBatch(uint8_t num, Ipl_Telegram_t tel[])
+{
+#ifdef IPL_USE_TRANSPORT
+    return Ipl_Trp->InicTransferBatch(num, tel);
+#else
+    return Ipl_InicTransferBatch(num, tel);
+#endif
+}
+#endif
+
+
+#ifdef IPL_INICDRIVER_OPENCLOSE
+/*! \internal Opens the INIC driver. */
+uint8_t Ipl_TrpInicDriverOpen(void)
+{
+#ifdef IPL_USE_TRANSPORT
+    uint8_t res = 1U;
+    if (NULL != Ipl_Trp)
+    {
+        res = (NULL != Ipl_Trp->InicDriverOpen) ? Ipl_Trp->InicDriverOpen() : 0U;
+    }
+    return res;
+#else
+    return Ipl_InicDriverOpen();
+#endif
+}
+
+
+/*! \internal Closes the INIC driver. */
+uint8_t Ipl_TrpInicDriverClose(void)
+{
+#ifdef IPL_USE_TRANSPORT
+    uint8_t res = 1U;
+    if (NULL != Ipl_Trp)
+    {
+        res = (NULL != Ipl_Trp->InicDriverClose) ? Ipl_Trp->InicDriverClose() : 0U;
+    }
+    return res;
+#else
+    return Ipl_InicDriverClose();
+#endif
+}
+#endif
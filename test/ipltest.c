@@ -0,0 +1,877 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipltest.c
+ *  \brief  Host tests for IPL (CRC, IPZ, IPB, IPF index, polling, FW programming), the INIC is simulated
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ *
+ *  Build: gcc -std=gnu99 -O2 -I../ipl/inc -I../ipl/cfg -DIPL_USE_HOSTCRC -DIPL_USE_IPZ -DIPL_USE_IPB
+ *         -DIPL_USE_SKIP_IDENTICAL_FW -DIPL_USE_TRANSPORT -DIPL_USE_SLEEPUS -DIPL_USE_COMPLETION_POLLING
+ *         -DIPL_USE_INICBATCH -o ipltest ipltest.c ../ipl/src/ip*.c
+ *  Usage: ipltest
+ *  Needs ipl_cfg.h with IPL_DATACHUNK_SIZE > 0, the IPF data is handed to IPL by Ipl_ProvideDataChunk().
+ *  The IPZ test packs a generated IPF with ipzpack.c, which is included for that. Every failed check
+ *  is printed, the exit code is 1 if any check failed. The INIC is a simulated OS81118 boot loader,
+ *  registered by Ipl_SetTransport(), its sleeps return at once and are recorded only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipl_pb.h"
+#include "ipf.h"
+#include "ipl_ipz.h"
+#include "ipl_ipb.h"
+
+#define main Ipzpack_Main
+#include "../tools/ipzpack/ipzpack.c"
+#undef main
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define TST_MAXLEN      8192U   /* Size of the IPF buffer */
+#define TST_MEMSIZE     0x30000U /* Program memory of the simulated OS81118 */
+#define TST_PAGESIZE    0x10000U /* Program memory page, addressed by 16 bit */
+#define TST_SECTIONSIZE 0x400U  /* Erase section */
+#define TST_INFOSIZE    0x400U  /* Info memory, 2 sections */
+#define TST_FWADDR      0xFF00U /* FW string of the page test, crosses the end of page 0 */
+#define TST_FWSIZE      0x200U
+#define TST_FWDATA      16U     /* Offset of the FW data in the IPF of Tst_PutFw() */
+#define TST_CHECK(cond) Tst_Check((cond), #cond, __LINE__)
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/* Strings of example/OS81210_Raspi_I2C.xml, each one ends with its CRC-16/KERMIT (LSB first) */
+static const uint8_t Tst_Str06[] = { 0x01, 0x00, 0x08, 0x12, 0x10, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x16,
+                                     0xFF, 0xFF, 0x85, 0x13 };
+static const uint8_t Tst_StrCs[] = { 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x08, 0x03, 0xFF, 0xFF,
+                                     0xFF, 0xFD, 0xA0, 0x01, 0x50, 0xAA, 0x00, 0x1D, 0xB4, 0x01, 0x17, 0x18,
+                                     0xE0, 0x00, 0x02, 0x04, 0x08, 0x10, 0x78, 0xF1, 0xE3, 0xC0, 0x00, 0x00,
+                                     0x30, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x60, 0x42, 0x82, 0x7F, 0xFF, 0xFF,
+                                     0x51, 0x6D };
+static const uint8_t Tst_StrIs[] = { 0x41, 0xFF, 0x01, 0x40, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                     0x32, 0xA5 };
+
+/* Boot loader of an OS81118, simulated by the transport callbacks */
+typedef struct Tst_Inic_
+{
+    uint8_t  Mem[TST_MEMSIZE];       /* Program memory */
+    uint8_t  Info[TST_INFOSIZE];     /* Info memory */
+    uint32_t Page;                   /* Page set by CMD_SETPROGMEMPAGE */
+    uint8_t  Resp[IPL_TEL_MAXLEN];   /* Response to the last telegram */
+    uint16_t Crc;                    /* CRC over the data written since CMD_CLEARCRC */
+    uint16_t FwCrc;                  /* FW CRC reported by CMD_READFWVER */
+    uint8_t  CrcFault;               /* Not 0 if CMD_GETCRC reports a wrong CRC */
+    uint32_t Erases;                 /* Number of CMD_ERASEPROGMEM */
+    uint32_t ReadBacks;              /* Number of CMD_READPROGMEM */
+    uint32_t Naks;                   /* Number of reads still to be NAKed */
+    uint32_t Busy;                   /* Number of reads NAKed after each program or info memory write */
+    uint32_t EraseBusy;              /* Number of reads NAKed after each erase */
+    uint32_t BootBusy;               /* Number of reads NAKed after RESET_ is released */
+    uint8_t  MaxBatch;               /* Most telegrams passed to Tst_InicTransferBatch() at once */
+    uint32_t WriteDelayUs;           /* DelayUs and PollUs of the last batched CMD_WRITEPROGMEM */
+    uint32_t WritePollUs;
+    uint32_t Wraps;                  /* CMD_WRITEPROGMEM telegrams that crossed the end of the page */
+    uint32_t Slept;                  /* Sum of all sleeps in us */
+    uint32_t MaxSleep;               /* Longest sleep in us */
+} Tst_Inic_t;
+
+static Tst_Inic_t Tst_Inic;
+static uint8_t  Tst_Ipf[TST_MAXLEN];            /* IPF data handed to IPL */
+static uint8_t  Tst_Chunk[IPL_DATACHUNK_SIZE];  /* Chunk returned by Ipl_ProvideDataChunk() */
+static uint32_t Tst_Failed;
+static uint32_t Tst_Checked;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* SIMULATED INIC, REGISTERED AS TRANSPORT                                                        */
+/*------------------------------------------------------------------------------------------------*/
+
+/* Returns 0 like a successful pin callback */
+static uint8_t Tst_SetPin(uint8_t lowHigh)
+{
+    (void) lowHigh;
+    return 0U;
+}
+
+/* Releasing RESET_ starts the simulated boot loader */
+static uint8_t Tst_SetResetPin(uint8_t lowHigh)
+{
+    if (IPL_HIGH == lowHigh)
+    {
+        Tst_Inic.Naks += Tst_Inic.BootBusy;
+    }
+    return 0U;
+}
+
+/* Executes the telegram on the simulated boot loader, the response is returned by the next read */
+static uint8_t Tst_InicWrite(uint8_t lData, uint8_t* pData)
+{
+    uint32_t addr;
+    uint32_t i;
+    (void) lData;
+    memset(Tst_Inic.Resp, 0, sizeof(Tst_Inic.Resp));
+    Tst_Inic.Resp[0] = 0xFFU; /* Completion code OK */
+    switch (pData[0])
+    {
+        case CMD_READFWVER:
+            Tst_Inic.Resp[7]  = 0x08U;
+            Tst_Inic.Resp[8]  = 0x11U;
+            Tst_Inic.Resp[9]  = 0x18U;
+            Tst_Inic.Resp[10] = 3U;
+            Tst_Inic.Resp[11] = 4U;
+            Tst_Inic.Resp[12] = 5U;
+            Tst_Inic.Resp[19] = (uint8_t) Tst_Inic.FwCrc;
+            break;
+        case CMD_SETPROGMEMPAGE:
+            Tst_Inic.Page = pData[1];
+            break;
+        case CMD_WRITEPROGMEM:
+            Tst_Inic.Naks += Tst_Inic.Busy;
+            addr = ((uint32_t) pData[1] << 8) | pData[2];
+            if ((addr + pData[3]) > TST_PAGESIZE)
+            {
+                Tst_Inic.Wraps++; /* The 16 bit address wraps around inside the page */
+            }
+            for (i = 0U; i < pData[3]; i++)
+            {
+                Tst_Inic.Mem[((Tst_Inic.Page * TST_PAGESIZE) + ((addr + i) % TST_PAGESIZE)) % TST_MEMSIZE] = pData[4U + i];
+            }
+            Tst_Inic.Crc = Ipl_CalcCrc(Tst_Inic.Crc, &pData[4], pData[3]);
+            break;
+        case CMD_READPROGMEM:
+            Tst_Inic.ReadBacks++;
+            addr = ((uint32_t) pData[1] << 8) | pData[2];
+            for (i = 0U; (i < pData[3]) && ((4U + i) < sizeof(Tst_Inic.Resp)); i++)
+            {
+                Tst_Inic.Resp[4U + i] = Tst_Inic.Mem[((Tst_Inic.Page * TST_PAGESIZE) + ((addr + i) % TST_PAGESIZE)) % TST_MEMSIZE];
+            }
+            break;
+        case CMD_ERASEPROGMEM:
+            Tst_Inic.Erases++;
+            Tst_Inic.Naks += Tst_Inic.EraseBusy;
+            for (i = (uint32_t) pData[1] * TST_SECTIONSIZE; (i < ((uint32_t) pData[1] + pData[2]) * TST_SECTIONSIZE) && (i < TST_MEMSIZE); i++)
+            {
+                Tst_Inic.Mem[i] = 0xFFU;
+            }
+            break;
+        case CMD_WRITEINFOMEM:
+            Tst_Inic.Naks += Tst_Inic.Busy;
+            addr = ((uint32_t) pData[1] << 8) | pData[2];
+            for (i = 0U; i < pData[3]; i++)
+            {
+                Tst_Inic.Info[(addr + i) % TST_INFOSIZE] = pData[4U + i];
+            }
+            break;
+        case CMD_READINFOMEM:
+            addr = ((uint32_t) pData[1] << 8) | pData[2];
+            for (i = 0U; (i < pData[3]) && ((4U + i) < sizeof(Tst_Inic.Resp)); i++)
+            {
+                Tst_Inic.Resp[4U + i] = Tst_Inic.Info[(addr + i) % TST_INFOSIZE];
+            }
+            break;
+        case CMD_ERASEINFOMEM:
+            Tst_Inic.Erases++;
+            Tst_Inic.Naks += Tst_Inic.EraseBusy;
+            memset(Tst_Inic.Info, 0xFF, sizeof(Tst_Inic.Info));
+            break;
+        case CMD_CLEARCRC:
+            Tst_Inic.Crc = 0U;
+            break;
+        case CMD_GETCRC:
+            Tst_Inic.Resp[4] = (uint8_t) (Tst_Inic.Crc >> 8);
+            Tst_Inic.Resp[5] = (uint8_t)  Tst_Inic.Crc ^ Tst_Inic.CrcFault;
+            break;
+        default:
+            break;
+    }
+    return 0U;
+}
+
+/* Returns the response to the last telegram, unless the read is NAKed */
+static uint8_t Tst_InicRead(uint8_t lData, uint8_t* pData)
+{
+    uint8_t res = 0U;
+    if (0U != Tst_Inic.Naks)
+    {
+        Tst_Inic.Naks--;
+        res = 1U;
+    }
+    else
+    {
+        memcpy(pData, Tst_Inic.Resp, (lData < sizeof(Tst_Inic.Resp)) ? lData : sizeof(Tst_Inic.Resp));
+    }
+    return res;
+}
+
+/* Does not sleep, only records the sleeps */
+static void Tst_SleepUs(uint32_t timeUs)
+{
+    Tst_Inic.Slept += timeUs;
+    if (timeUs > Tst_Inic.MaxSleep)
+    {
+        Tst_Inic.MaxSleep = timeUs;
+    }
+}
+
+static void Tst_Sleep(uint16_t timeMs)
+{
+    Tst_SleepUs((uint32_t) timeMs * 1000U);
+}
+
+/* Executes the telegrams one after the other, waiting or polling for each response as specified */
+static uint8_t Tst_InicTransferBatch(uint8_t num, Ipl_Telegram_t tel[])
+{
+    uint8_t  i;
+    uint8_t  stop = 0U;
+    uint32_t step;
+    if (num > Tst_Inic.MaxBatch)
+    {
+        Tst_Inic.MaxBatch = num;
+    }
+    for (i = 0U; (i < num) && (0U == stop); i++)
+    {
+        if (CMD_WRITEPROGMEM == tel[i].Tx[0])
+        {
+            Tst_Inic.WriteDelayUs = tel[i].DelayUs;
+            Tst_Inic.WritePollUs  = tel[i].PollUs;
+        }
+        (void) Tst_InicWrite(tel[i].TxLen, tel[i].Tx);
+        step = tel[i].PollUs;
+        tel[i].TimeUs = 0U;
+        if (0U == step)
+        {
+            Tst_SleepUs(tel[i].DelayUs);
+            tel[i].TimeUs = tel[i].DelayUs;
+        }
+        tel[i].Res = (0U == Tst_InicRead(tel[i].RxLen, tel[i].Rx)) ? 0U : 2U;
+        while ((0U != step) && (0U != tel[i].Res) && (tel[i].TimeUs < tel[i].DelayUs))
+        {
+            if (step > (tel[i].DelayUs - tel[i].TimeUs))
+            {
+                step = tel[i].DelayUs - tel[i].TimeUs;
+            }
+            Tst_SleepUs(step);
+            tel[i].TimeUs += step;
+            step = ((2U * step) < INIC_POLL_MAX_STEP_TIME) ? (2U * step) : INIC_POLL_MAX_STEP_TIME;
+            tel[i].Res = (0U == Tst_InicRead(tel[i].RxLen, tel[i].Rx)) ? 0U : 2U;
+        }
+        stop = tel[i].Res;
+    }
+    return i;
+}
+
+static const Ipl_Transport_t Tst_Trp =
+{
+    .Caps          = IPL_TRP_CAP_SLEEPUS,
+    .SetResetPin   = Tst_SetResetPin,
+    .SetErrBootPin = Tst_SetPin,
+    .InicRead      = Tst_InicRead,
+    .InicWrite     = Tst_InicWrite,
+    .Sleep         = Tst_Sleep,
+    .SleepUs       = Tst_SleepUs,
+};
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* IPL CALLBACKS                                                                                  */
+/*------------------------------------------------------------------------------------------------*/
+
+void Ipl_Trace(const char* tag, const char* fmt, ...)
+{
+    (void) tag;
+    (void) fmt;
+}
+
+void Ipl_Progress(uint8_t percent)
+{
+    (void) percent;
+}
+
+/* Serves Tst_Ipf, whatever pData IPL refers */
+uint8_t* Ipl_ProvideDataChunk(uint32_t sIndex, uint32_t lData)
+{
+    uint32_t len = lData;
+    memset(Tst_Chunk, 0, sizeof(Tst_Chunk));
+    if (sIndex < TST_MAXLEN)
+    {
+        if (len > (TST_MAXLEN - sIndex))
+        {
+            len = TST_MAXLEN - sIndex;
+        }
+        if (len > sizeof(Tst_Chunk))
+        {
+            len = sizeof(Tst_Chunk);
+        }
+        memcpy(Tst_Chunk, &Tst_Ipf[sIndex], len);
+    }
+    return Tst_Chunk;
+}
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static void Tst_Check(int ok, const char* expr, int line)
+{
+    Tst_Checked++;
+    if (0 == ok)
+    {
+        Tst_Failed++;
+        printf("ipltest.c:%d: check failed: %s\n", line, expr);
+    }
+}
+
+static void Tst_Put32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t) (v >> 24);
+    p[1] = (uint8_t) (v >> 16);
+    p[2] = (uint8_t) (v >>  8);
+    p[3] = (uint8_t)  v;
+}
+
+/* Adds a string to the IPF data at offset, returns the offset of the next string header */
+static uint32_t Tst_PutString(uint8_t* pIpf, uint32_t offset, uint8_t type, uint32_t addr, const uint8_t* pData, uint32_t size)
+{
+    pIpf[offset]      = type;
+    pIpf[offset + 1U] = 0x01U;
+    Tst_Put32(&pIpf[offset + 2U], addr);
+    Tst_Put32(&pIpf[offset + 6U], size);
+    if (NULL != pData)
+    {
+        memcpy(&pIpf[offset + 10U], pData, size);
+    }
+    return offset + 10U + size;
+}
+
+/* Starts an IPF for chip at offset 0, returns the offset of the first string header */
+static uint32_t Tst_StartIpf(uint8_t* pIpf, uint8_t chip)
+{
+    memset(pIpf, 0, TST_MAXLEN);
+    pIpf[0] = 0x01U;
+    pIpf[1] = chip;
+    pIpf[2] = 0xFFU;
+    pIpf[3] = 0xFFU;
+    pIpf[4] = 0xFFU;
+    pIpf[5] = 0xFFU;
+    return 6U;
+}
+
+/* CRC-16/KERMIT of the host CRC check */
+static void Tst_Crc(void)
+{
+    const uint8_t* pCheck = (const uint8_t*) "123456789";
+    const Ipl_IpfCrc_t* pCrc;
+    uint32_t offset;
+    TST_CHECK(0x2189U == Ipl_CalcCrc(0U, pCheck, 9U));
+    TST_CHECK(0x2189U == Ipl_CalcCrc(Ipl_CalcCrc(0U, pCheck, 4U), &pCheck[4], 5U)); /* Continued over chunks */
+    TST_CHECK(0U == Ipl_CalcCrc(0U, Tst_Str06, sizeof(Tst_Str06)));
+    TST_CHECK(0U == Ipl_CalcCrc(0U, Tst_StrCs, sizeof(Tst_StrCs)));
+    TST_CHECK(0U == Ipl_CalcCrc(0U, Tst_StrIs, sizeof(Tst_StrIs)));
+    TST_CHECK(0U != Ipl_CalcCrc(0U, Tst_StrIs, sizeof(Tst_StrIs) - 1U));
+
+    /* Same residue for the strings read from the IPF data */
+    offset = Tst_StartIpf(Tst_Ipf, IPL_CHIP_OS81210);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_CS, 0U, Tst_StrCs, sizeof(Tst_StrCs));
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_IS, 0U, Tst_StrIs, sizeof(Tst_StrIs));
+    Ipl_ClrIpfData(&Ipl_IpfData, IPL_CHIP_OS81210);
+    pCrc = Ipl_GetIpfCrc(&Ipl_IpfData, offset, Tst_Ipf, STRINGTYPE_CS);
+    TST_CHECK((NULL != pCrc) && (0U == pCrc->Crc));
+    pCrc = Ipl_GetIpfCrc(&Ipl_IpfData, offset, Tst_Ipf, STRINGTYPE_IS);
+    TST_CHECK((NULL != pCrc) && (0U == pCrc->Crc));
+    pCrc = Ipl_GetIpfCrc(&Ipl_IpfData, offset, Tst_Ipf, STRINGTYPE_FW);
+    TST_CHECK(NULL == pCrc);
+}
+
+/* Packs an IPF with ipzpack and reads it back through the container */
+static void Tst_Ipz(void)
+{
+    char     inName[]  = "/tmp/ipltest_XXXXXX";
+    char     outName[] = "/tmp/ipltest_XXXXXX";
+    char*    argv[4];
+    uint8_t* ipf;
+    uint8_t* ipz;
+    uint32_t lIpf, lIpz, lData = 0U, i, diff = 0U;
+    uint32_t rnd = 1U;
+    uint32_t offset;
+    FILE*    fp;
+    int      fd1 = mkstemp(inName);
+    int      fd2 = mkstemp(outName);
+
+    /* FW string partly random (stored blocks), partly repeating (compressed blocks), not a multiple of the block size */
+    offset = Tst_StartIpf(Tst_Ipf, IPL_CHIP_OS81118);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_CS, 0U, Tst_StrCs, sizeof(Tst_StrCs));
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_FW, 0x1000U, NULL, 7000U);
+    for (i = 76U; i < 2800U; i++)
+    {
+        rnd = (rnd * 1103515245U) + 12345U;
+        Tst_Ipf[i] = (uint8_t) (rnd >> 16);
+    }
+    for (; i < offset; i++)
+    {
+        Tst_Ipf[i] = (uint8_t) (i % 13U);
+    }
+    lIpf = offset;
+    TST_CHECK((0 <= fd1) && (0 <= fd2));
+    fp = fdopen(fd1, "wb");
+    TST_CHECK((NULL != fp) && (1U == fwrite(Tst_Ipf, lIpf, 1U, fp)));
+    if (NULL != fp)
+    {
+        fclose(fp);
+    }
+    close(fd2);
+    argv[0] = "ipzpack";
+    argv[1] = inName;
+    argv[2] = outName;
+    argv[3] = NULL;
+    TST_CHECK(0 == Ipzpack_Main(3, argv));
+    ipz = load_file(outName, &lIpz);
+    ipf = malloc(lIpf);
+    TST_CHECK((NULL != ipz) && (NULL != ipf) && (lIpz < lIpf));
+    if ((NULL != ipz) && (NULL != ipf))
+    {
+        memcpy(ipf, Tst_Ipf, lIpf);
+        memset(Tst_Ipf, 0, sizeof(Tst_Ipf)); /* Ipl_ProvideDataChunk() must not be used */
+        TST_CHECK(IPL_RES_OK == Ipl_IpzOpen(ipz, lIpz, &lData));
+        TST_CHECK(lIpf == lData);
+        TST_CHECK(IPL_RES_OK == Ipl_ClrPData(lData, ipz));
+        for (i = 0U; i < lIpf; i++)
+        {
+            diff += (Ipl_PData(i, lData, ipz) != ipf[i]) ? 1U : 0U;
+        }
+        for (i = lIpf; i > 0U; i -= (i > 777U) ? 777U : i)
+        {
+            diff += (Ipl_PData(i - 1U, lData, ipz) != ipf[i - 1U]) ? 1U : 0U; /* Backwards over the blocks */
+        }
+        TST_CHECK(0U == diff);
+        TST_CHECK(IPL_RES_OK == Ipl_IpzClose());
+        TST_CHECK(IPL_RES_ERR_NOT_SUPPORTED == Ipl_IpzClose());
+        ipz[3] ^= 0x40U;
+        TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpzOpen(ipz, lIpz, &lData));
+        ipz[3] ^= 0x40U;
+        TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpzOpen(ipz, lIpz - 1U, &lData));
+        if (IPL_HIGH == Ipl_IpzIsOpen())
+        {
+            (void) Ipl_IpzClose();
+        }
+    }
+    free(ipz);
+    free(ipf);
+    unlink(inName);
+    unlink(outName);
+}
+
+/* Adds a member entry to the bundle */
+static void Tst_PutMember(uint8_t* pIpb, uint32_t index, uint8_t chip, uint8_t fwMajor, uint8_t fwMinor, uint32_t offset, uint32_t len)
+{
+    uint8_t* e = &pIpb[IPB_HEADER_LEN + (index * IPB_ENTRY_LEN)];
+    memset(e, 0xFF, IPB_ENTRY_LEN);
+    e[0] = chip;
+    e[1] = fwMajor;
+    e[2] = fwMinor;
+    e[3] = 0U;
+    e[7] = 0U;
+    Tst_Put32(&e[8], offset);
+    Tst_Put32(&e[12], len);
+}
+
+/* Selects members from a bundle of two OS81118 IPFs and one OS81210 IPF */
+static void Tst_Ipb(void)
+{
+    static uint8_t ipb[IPB_INDEX_LEN(3) + 96U];
+    Ipl_IpbMember_t m;
+    uint32_t data = IPB_INDEX_LEN(3);
+    uint32_t lIpb = sizeof(ipb);
+    uint8_t  saved = Ipl_InicData.ChipID;
+
+    memset(ipb, 0, sizeof(ipb));
+    ipb[0] = 'I';
+    ipb[1] = 'P';
+    ipb[2] = 'B';
+    ipb[3] = IPB_VERSION;
+    Tst_Put32(&ipb[4], lIpb);
+    Tst_Put32(&ipb[8], 3U);
+    ipb[16U + (2U * IPL_CHIP_OS81118)]      = 0U; /* First member */
+    ipb[16U + (2U * IPL_CHIP_OS81118) + 1U] = 2U; /* Number of members */
+    ipb[16U + (2U * IPL_CHIP_OS81210)]      = 2U;
+    ipb[16U + (2U * IPL_CHIP_OS81210) + 1U] = 1U;
+    Tst_PutMember(ipb, 0U, IPL_CHIP_OS81118, 2U, 0U, data,       32U); /* Newest first */
+    Tst_PutMember(ipb, 1U, IPL_CHIP_OS81118, 1U, 2U, data + 32U, 32U);
+    Tst_PutMember(ipb, 2U, IPL_CHIP_OS81210, 3U, 1U, data + 64U, 32U);
+
+    Ipl_InicData.ChipID = IPL_CHIP_OS81118;
+    memset(&m, IPB_ANY, sizeof(m));
+    TST_CHECK((IPL_RES_OK == Ipl_IpbSelect(ipb, lIpb, &m)) && (IPL_CHIP_OS81118 == m.ChipID) &&
+              (2U == m.FwMajorVersion) && (data == m.Offset) && (32U == m.Length));
+    memset(&m, IPB_ANY, sizeof(m));
+    m.FwMajorVersion = 1U;
+    TST_CHECK((IPL_RES_OK == Ipl_IpbSelect(ipb, lIpb, &m)) && (2U == m.FwMinorVersion) && ((data + 32U) == m.Offset));
+    memset(&m, IPB_ANY, sizeof(m));
+    m.FwMajorVersion = 9U;
+    TST_CHECK(IPL_RES_ERR_IPF_WRONGINIC == Ipl_IpbSelect(ipb, lIpb, &m));
+    memset(&m, IPB_ANY, sizeof(m));
+    m.ChipID = IPL_CHIP_OS81210;
+    TST_CHECK((IPL_RES_OK == Ipl_IpbSelect(ipb, lIpb, &m)) && (3U == m.FwMajorVersion) && ((data + 64U) == m.Offset));
+    memset(&m, IPB_ANY, sizeof(m));
+    m.ChipID = IPL_CHIP_OS81214;
+    TST_CHECK(IPL_RES_ERR_IPF_WRONGINIC == Ipl_IpbSelect(ipb, lIpb, &m));
+    Ipl_InicData.ChipID = DEFAULTVAL_UINT8;
+    memset(&m, IPB_ANY, sizeof(m));
+    TST_CHECK(IPL_RES_ERR_NOVALIDCHIPID == Ipl_IpbSelect(ipb, lIpb, &m));
+
+    /* Invalid bundles */
+    Ipl_InicData.ChipID = IPL_CHIP_OS81118;
+    memset(&m, IPB_ANY, sizeof(m));
+    TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpbSelect(ipb, lIpb - 1U, &m));
+    ipb[16U + (2U * IPL_CHIP_OS81118) + 1U] = 9U; /* More members than the bundle holds */
+    TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpbSelect(ipb, lIpb, &m));
+    ipb[16U + (2U * IPL_CHIP_OS81118) + 1U] = 2U;
+    Tst_Put32(&ipb[IPB_HEADER_LEN + 12U], 0x1000U); /* Member exceeds the bundle */
+    TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpbSelect(ipb, lIpb, &m));
+    Tst_Put32(&ipb[IPB_HEADER_LEN + 12U], 32U);
+    ipb[3] = IPB_VERSION + 1U;
+    TST_CHECK(IPL_RES_ERR_IPF_INVALID == Ipl_IpbSelect(ipb, lIpb, &m));
+    Ipl_InicData.ChipID = saved;
+}
+
+/* The string index follows the IPF data, also when the same buffer is refilled */
+static void Tst_Index(void)
+{
+    uint32_t offset;
+    uint32_t lData;
+
+    offset = Tst_StartIpf(Tst_Ipf, IPL_CHIP_OS81118);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_CS, 0U,      NULL, 100U);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_FW, 0x1000U, NULL, 200U);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_IS, 0U,      NULL, 50U);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_FW, 0x2000U, NULL, 40U);
+    lData  = offset;
+    Ipl_ClrIpfData(&Ipl_IpfData, IPL_CHIP_OS81118);
+    TST_CHECK(IPL_RES_OK == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_CS));
+    TST_CHECK((16U == Ipl_IpfData.StringOffset) && (100U == Ipl_IpfData.StringSize));
+    TST_CHECK(4U == Ipl_IpfData.Index.NumOfStrings); /* Whole table after the first parse */
+    TST_CHECK(IPL_RES_OK == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_FW));
+    TST_CHECK((126U == Ipl_IpfData.StringOffset) && (0x1000U == Ipl_IpfData.ProgAddr)); /* First FW string */
+    TST_CHECK(IPL_RES_OK == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_IS));
+    TST_CHECK(IPL_RES_ERR_IPF_WRONGSTRINGTYPE == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_PS));
+
+    /* Another IPF of the same length in the same buffer */
+    offset = Tst_StartIpf(Tst_Ipf, IPL_CHIP_OS81118);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_CS, 0U,      NULL, 300U);
+    offset = Tst_PutString(Tst_Ipf, offset, STRINGTYPE_FW, 0x3000U, NULL, lData - offset - 10U);
+    TST_CHECK(lData == offset);
+    TST_CHECK(IPL_RES_OK == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_FW));
+    TST_CHECK((326U == Ipl_IpfData.StringOffset) && (0x3000U == Ipl_IpfData.ProgAddr));
+    TST_CHECK(2U == Ipl_IpfData.Index.NumOfStrings);
+    TST_CHECK(IPL_RES_ERR_IPF_WRONGSTRINGTYPE == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_IS));
+
+    /* Another length and another INIC */
+    TST_CHECK(IPL_RES_OK == Ipl_ParseIpf(&Ipl_IpfData, lData - 10U, Tst_Ipf, STRINGTYPE_CS));
+    Tst_Ipf[1] = IPL_CHIP_OS81210;
+    TST_CHECK(IPL_RES_ERR_IPF_WRONGINIC == Ipl_ParseIpf(&Ipl_IpfData, lData, Tst_Ipf, STRINGTYPE_CS));
+
+    /* Ipl_ClrIpfData() drops the index */
+    Ipl_ClrIpfData(&Ipl_IpfData, IPL_CHIP_OS81210);
+    TST_CHECK((IPL_LOW == Ipl_IpfData.Index.Valid) && (0U == Ipl_IpfData.Index.NumOfStrings));
+}
+
+/* Sends CMD_WRITEPROGMEM with 4 bytes to address 0 */
+static uint8_t Tst_WriteProgMem(void)
+{
+    Ipl_ClrTel();
+    Ipl_IplData.Tel[0] = CMD_WRITEPROGMEM;
+    Ipl_IplData.Tel[3] = 4U;
+    Ipl_IplData.TelLen = 8U;
+    Tst_Inic.Slept     = 0U;
+    Tst_Inic.MaxSleep  = 0U;
+    return Ipl_ExecInicCmd();
+}
+
+/* Completion polling reads again with doubled steps up to INIC_POLL_MAX_STEP_TIME, the statistics
+   count the time until INIC answered */
+static void Tst_Poll(void)
+{
+    Ipl_TimingProfile_t prof;
+    const Ipl_CmdStat_t* pStat;
+
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&Tst_Trp));
+    TST_CHECK(IPL_RES_OK == Ipl_EnterProgMode(IPL_CHIP_OS81118));
+    TST_CHECK(IPL_CHIP_OS81118 == Ipl_InicData.ChipID);
+    TST_CHECK(NULL == Ipl_GetCmdStat(CMD_WRITEPROGMEM));
+    TST_CHECK(IPL_RES_OK == Ipl_GetTimingProfile(IPL_CHIP_OS81118, &prof));
+    prof.ProgramWaitTime = 4000000U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTimingProfile(IPL_CHIP_OS81118, &prof));
+
+    /* 12 NAKs: 100, 200, ..., 51200 us, then the step stays at 64000 us */
+    Tst_Inic.Naks = 12U;
+    TST_CHECK(IPL_RES_OK == Tst_WriteProgMem());
+    TST_CHECK(INIC_POLL_MAX_STEP_TIME == Tst_Inic.MaxSleep);
+    TST_CHECK(230300U == Tst_Inic.Slept);
+    pStat = Ipl_GetCmdStat(CMD_WRITEPROGMEM);
+    TST_CHECK(NULL != pStat);
+    if (NULL != pStat)
+    {
+        TST_CHECK((1U == pStat->Count) && (1U == pStat->DoneCount));
+        TST_CHECK((230300U == pStat->DoneMaxTime) && (230300U == pStat->MaxTime));
+    }
+
+    /* Many NAKs, the step never exceeds the cap */
+    Tst_Inic.Naks = 40U;
+    TST_CHECK(IPL_RES_OK == Tst_WriteProgMem());
+    TST_CHECK((INIC_POLL_MAX_STEP_TIME == Tst_Inic.MaxSleep) && (0U == Tst_Inic.Naks));
+    TST_CHECK((102300U + (30U * INIC_POLL_MAX_STEP_TIME)) == Tst_Inic.Slept);
+
+    /* Answered at once */
+    TST_CHECK(IPL_RES_OK == Tst_WriteProgMem());
+    TST_CHECK(0U == Tst_Inic.Slept);
+    pStat = Ipl_GetCmdStat(CMD_WRITEPROGMEM);
+    if (NULL != pStat)
+    {
+        TST_CHECK((3U == pStat->Count) && (3U == pStat->DoneCount) && (0U == pStat->MinTime));
+        TST_CHECK((102300U + (30U * INIC_POLL_MAX_STEP_TIME)) == pStat->DoneMaxTime);
+    }
+
+    /* Never answered: polling ends after ProgramWaitTime, the regular read reports the error */
+    prof.ProgramWaitTime = 5000U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTimingProfile(IPL_CHIP_OS81118, &prof));
+    Tst_Inic.Naks = 1000U;
+    TST_CHECK(IPL_RES_ERR_READ == Tst_WriteProgMem());
+    TST_CHECK(5000U == Tst_Inic.Slept);
+    pStat = Ipl_GetCmdStat(CMD_WRITEPROGMEM);
+    if (NULL != pStat)
+    {
+        TST_CHECK((4U == pStat->Count) && (3U == pStat->DoneCount));
+        TST_CHECK((102300U + (30U * INIC_POLL_MAX_STEP_TIME)) == pStat->DoneMaxTime);
+    }
+    Tst_Inic.Naks = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTimingProfile(IPL_CHIP_OS81118, NULL));
+    TST_CHECK(IPL_RES_OK == Ipl_LeaveProgMode());
+}
+
+/* Puts an IPF with a FW string at TST_FWADDR into Tst_Ipf, returns its length and the CRC of the
+   FW data, which is appended to the string */
+static uint32_t Tst_PutFw(uint16_t* pCrc)
+{
+    uint32_t offset;
+    uint32_t i;
+    uint8_t* pFw;
+
+    offset = Tst_StartIpf(Tst_Ipf, IPL_CHIP_OS81118);
+    pFw = &Tst_Ipf[offset + 10U];
+    for (i = 0U; i < (TST_FWSIZE - 2U); i++)
+    {
+        pFw[i] = (uint8_t) ((i * 7U) + 1U);
+    }
+    *pCrc = Ipl_CalcCrc(0U, pFw, TST_FWSIZE - 2U);
+    pFw[TST_FWSIZE - 2U] = (uint8_t)  *pCrc;
+    pFw[TST_FWSIZE - 1U] = (uint8_t) (*pCrc >> 8);
+    return Tst_PutString(Tst_Ipf, offset, STRINGTYPE_FW, TST_FWADDR, NULL, TST_FWSIZE);
+}
+
+/* Telegrams of 30 bytes do not divide the page size, the last telegram of a page ends at the page
+   end and the next page is set, instead of wrapping around to the start of the page */
+static void Tst_Page(void)
+{
+    static Ipl_Transport_t trp;
+    uint32_t lData;
+    uint16_t crc;
+
+    trp = Tst_Trp;
+    trp.MaxTelLen = 34U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&trp));
+    TST_CHECK(IPL_RES_OK == Ipl_EnterProgMode(IPL_CHIP_OS81118));
+    TST_CHECK(30U == Ipl_GetDataLen());
+    lData = Tst_PutFw(&crc);
+    memset(Tst_Inic.Mem, 0, sizeof(Tst_Inic.Mem));
+    Tst_Inic.Wraps = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_Prog(IPL_JOB_PROG_FIRMWARE, lData, Tst_Ipf));
+    TST_CHECK(0U == Tst_Inic.Wraps);
+    TST_CHECK(0 == memcmp(&Tst_Inic.Mem[TST_FWADDR], &Tst_Ipf[TST_FWDATA], TST_FWSIZE));
+    TST_CHECK(IPL_RES_OK == Ipl_LeaveProgMode());
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&Tst_Trp));
+}
+
+/* Programs the FW string of Tst_PutFw() with a fresh IPL state, returns the result */
+static uint8_t Tst_ProgFw(uint32_t lData)
+{
+    uint8_t res;
+    Tst_Inic.Erases    = 0U;
+    Tst_Inic.ReadBacks = 0U;
+    res = Ipl_EnterProgMode(IPL_CHIP_OS81118);
+    if (IPL_RES_OK == res)
+    {
+        res = Ipl_Prog(IPL_JOB_PROG_FIRMWARE, lData, Tst_Ipf);
+    }
+    (void) Ipl_LeaveProgMode();
+    return res;
+}
+
+/* The host CRC stops programming before the erase and at a page end, identical firmware is
+   recognized by its CRC first */
+static void Tst_HostCrc(void)
+{
+    uint32_t lData;
+    uint16_t crc;
+
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&Tst_Trp));
+    lData = Tst_PutFw(&crc);
+
+    /* FW string without its CRC: nothing is erased */
+    Tst_Ipf[TST_FWDATA + TST_FWSIZE - 1U] ^= 0x01U;
+    memset(Tst_Inic.Mem, 0x5A, sizeof(Tst_Inic.Mem));
+    TST_CHECK(IPL_RES_ERR_WRONG_CRC == Tst_ProgFw(lData));
+    TST_CHECK((0U == Tst_Inic.Erases) && (0x5AU == Tst_Inic.Mem[TST_FWADDR]));
+    Tst_Ipf[TST_FWDATA + TST_FWSIZE - 1U] ^= 0x01U;
+
+    /* INIC reports a wrong CRC at the end of page 0: the next page is not written */
+    Tst_Inic.CrcFault = 0x01U;
+    TST_CHECK(IPL_RES_ERR_WRONG_CRC == Tst_ProgFw(lData));
+    TST_CHECK((1U == Tst_Inic.Erases) && (0x5AU == Tst_Inic.Mem[TST_PAGESIZE]));
+    Tst_Inic.CrcFault = 0x00U;
+
+    /* Programmed, the INIC reports another FW CRC */
+    Tst_Inic.FwCrc = (uint16_t) (crc + 1U);
+    TST_CHECK(IPL_RES_OK == Tst_ProgFw(lData));
+    TST_CHECK((1U == Tst_Inic.Erases) && (0U == Tst_Inic.ReadBacks));
+    TST_CHECK(0 == memcmp(&Tst_Inic.Mem[TST_FWADDR], &Tst_Ipf[TST_FWDATA], TST_FWSIZE));
+
+    /* Same CRC and same memory: skipped after reading back */
+    Tst_Inic.FwCrc = crc;
+    TST_CHECK(IPL_RES_OK == Tst_ProgFw(lData));
+    TST_CHECK((0U == Tst_Inic.Erases) && (0U != Tst_Inic.ReadBacks));
+
+    /* Same CRC, but the memory differs: programmed */
+    Tst_Inic.Mem[TST_FWADDR + TST_FWSIZE - 3U] ^= 0x01U;
+    TST_CHECK(IPL_RES_OK == Tst_ProgFw(lData));
+    TST_CHECK((1U == Tst_Inic.Erases) && (0U != Tst_Inic.ReadBacks));
+    TST_CHECK(0 == memcmp(&Tst_Inic.Mem[TST_FWADDR], &Tst_Ipf[TST_FWDATA], TST_FWSIZE));
+    Tst_Inic.FwCrc = 0U;
+}
+
+/* Program memory writes are batched with their real wait time, the transport polls each response */
+static void Tst_Batch(void)
+{
+    static Ipl_Transport_t trp;
+    const Ipl_CmdStat_t* pStat;
+    uint32_t lData;
+    uint16_t crc;
+
+    trp = Tst_Trp;
+    trp.Caps |= IPL_TRP_CAP_BATCH;
+    trp.InicTransferBatch = Tst_InicTransferBatch;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&trp));
+    lData = Tst_PutFw(&crc);
+    memset(Tst_Inic.Mem, 0, sizeof(Tst_Inic.Mem));
+    Tst_Inic.Busy     = 2U; /* Each write is completed after 100 + 200 us */
+    Tst_Inic.MaxBatch = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_EnterProgMode(IPL_CHIP_OS81118));
+    TST_CHECK(IPL_RES_OK == Ipl_Prog(IPL_JOB_PROG_FIRMWARE, lData, Tst_Ipf));
+    TST_CHECK(0 == memcmp(&Tst_Inic.Mem[TST_FWADDR], &Tst_Ipf[TST_FWDATA], TST_FWSIZE));
+    TST_CHECK(INIC_MAX_BATCH == Tst_Inic.MaxBatch);
+    TST_CHECK((INIC_PROGRAM_WAIT_TIME == Tst_Inic.WriteDelayUs) && (INIC_POLL_START_TIME == Tst_Inic.WritePollUs));
+    pStat = Ipl_GetCmdStat(CMD_WRITEPROGMEM);
+    TST_CHECK(NULL != pStat);
+    if (NULL != pStat)
+    {
+        TST_CHECK(((TST_FWSIZE / 32U) == pStat->Count) && (pStat->Count == pStat->DoneCount));
+        TST_CHECK((300U == pStat->MinTime) && (300U == pStat->DoneMaxTime));
+    }
+    TST_CHECK(IPL_RES_OK == Ipl_LeaveProgMode());
+    Tst_Inic.Busy = 0U;
+    Tst_Inic.Naks = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&Tst_Trp));
+}
+
+/* Calibration probes INIC itself, program and erase times are only measured on erased memory */
+static void Tst_Calib(void)
+{
+    Ipl_TimingProfile_t prof;
+
+    TST_CHECK(IPL_RES_OK == Ipl_SetTransport(&Tst_Trp));
+    TST_CHECK(IPL_RES_OK == Ipl_EnterProgMode(IPL_CHIP_OS81118));
+    memset(Tst_Inic.Mem, 0xFF, sizeof(Tst_Inic.Mem));
+    memset(Tst_Inic.Info, 0xFF, sizeof(Tst_Inic.Info));
+    Tst_Inic.BootBusy  = 40U; /* ACK after 40 * 500 us */
+    Tst_Inic.Busy      = 3U;  /* Writes are completed after 3 * 100 us */
+    Tst_Inic.EraseBusy = 5U;  /* Erases are completed after 5 * 100 us */
+    Tst_Inic.Erases    = 0U;
+
+    /* Everything erased: all times are measured, plus 25% and the margin */
+    TST_CHECK(IPL_RES_OK == Ipl_Prog(IPL_JOB_CALIBRATE_TIMING, 0U, NULL));
+    TST_CHECK(IPL_RES_OK == Ipl_GetTimingProfile(IPL_CHIP_OS81118, &prof));
+    TST_CHECK(15100U == prof.BootupTime);      /* 20000 us minus INIC_PIN_WAIT_TIME */
+    TST_CHECK(475U == prof.RespWaitTime);      /* Info memory write */
+    TST_CHECK(475U == prof.ProgramWaitTime);
+    TST_CHECK(116350U == prof.EraseProgMemWaitTime); /* 500 us for each of 186 sections */
+    TST_CHECK(725U == prof.EraseInfoMemWaitTime);
+    TST_CHECK(2U == Tst_Inic.Erases);
+    TST_CHECK((0xFFU == Tst_Inic.Mem[TST_MEMSIZE - TST_SECTIONSIZE]) && (0xFFU == Tst_Inic.Info[0]));
+
+    /* Memory in use: program and erase times keep their default */
+    Tst_Inic.Mem[TST_MEMSIZE - 1U] = 0x00U;
+    Tst_Inic.Info[0x100U] = 0x00U;
+    Tst_Inic.Erases = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_Prog(IPL_JOB_CALIBRATE_TIMING, 0U, NULL));
+    TST_CHECK(IPL_RES_OK == Ipl_GetTimingProfile(IPL_CHIP_OS81118, &prof));
+    TST_CHECK((15100U == prof.BootupTime) && (INIC_CALIB_MARGIN_TIME == prof.RespWaitTime));
+    TST_CHECK(INIC_PROGRAM_WAIT_TIME == prof.ProgramWaitTime);
+    TST_CHECK(INIC_ERASEPROGMEM_WAIT_TIME == prof.EraseProgMemWaitTime);
+    TST_CHECK(INIC_ERASEINFOMEM_WAIT_TIME == prof.EraseInfoMemWaitTime);
+    TST_CHECK((0U == Tst_Inic.Erases) && (0x00U == Tst_Inic.Mem[TST_MEMSIZE - 1U]) && (0x00U == Tst_Inic.Info[0x100U]));
+
+    /* Bootloader never acknowledges: the previous profile is kept */
+    Tst_Inic.BootBusy = 1000U;
+    TST_CHECK(IPL_RES_OK != Ipl_Prog(IPL_JOB_CALIBRATE_TIMING, 0U, NULL));
+    TST_CHECK(IPL_RES_OK == Ipl_GetTimingProfile(IPL_CHIP_OS81118, &prof));
+    TST_CHECK(15100U == prof.BootupTime);
+    Tst_Inic.BootBusy  = 0U;
+    Tst_Inic.Busy      = 0U;
+    Tst_Inic.EraseBusy = 0U;
+    Tst_Inic.Naks      = 0U;
+    TST_CHECK(IPL_RES_OK == Ipl_SetTimingProfile(IPL_CHIP_OS81118, NULL));
+    TST_CHECK(IPL_RES_OK == Ipl_LeaveProgMode());
+}
+
+int main(void)
+{
+    Tst_Crc();
+    Tst_Ipz();
+    Tst_Ipb();
+    Tst_Index();
+    Tst_Poll();
+    Tst_Page();
+    Tst_HostCrc();
+    Tst_Batch();
+    Tst_Calib();
+    printf("%u checks, %u failed\n", Tst_Checked, Tst_Failed);
+    return (0U == Tst_Failed) ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipbpack.c
+ *  \brief  Host tool that packs several IPF files into a multi-chip IPF bundle (see ipl_ipb.h)
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ *
+ *  Build: gcc -std=gnu99 -O2 -o ipbpack ipbpack.c
+ *  Usage: ipbpack output.ipb input.ipf...
+ *  ChipID and versions are taken from the IPF header and META string of each input file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define IPB_VERSION     0x01U
+#define IPB_HEADER_LEN  528U
+#define IPB_ENTRY_LEN   16U
+#define IPB_MAX_MEMBERS 255U
+#define HEADER_LEN      6U      /* IPF file header, ChipID at offset 1 */
+#define STRHDR_LEN      10U     /* String header: type, reserved, address, size */
+#define METAITEM_LEN    12U
+#define STRINGTYPE_FW   0x01U
+#define STRINGTYPE_CS   0x03U
+#define STRINGTYPE_META 0x07U
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* TYPES                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+
+typedef struct Member_
+{
+    const char* file;
+    uint8_t*    data;
+    uint32_t    len;
+    uint8_t     ver[7];   /* ChipID, FW major/minor/release, CFGS major/minor/release */
+} Member_t;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t) (v >> 24);
+    p[1] = (uint8_t) (v >> 16);
+    p[2] = (uint8_t) (v >>  8);
+    p[3] = (uint8_t)  v;
+}
+
+static uint32_t get32(const uint8_t* p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+static uint8_t* load_file(const char* fileName, uint32_t* pLen)
+{
+    uint8_t* p  = NULL;
+    long     tl = -1;
+    FILE*    fp = fopen(fileName, "rb");
+    if (NULL != fp)
+    {
+        fseek(fp, 0, SEEK_END);
+        tl = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        if ((tl > 6) && (tl <= 0x7FFFFFFFL))
+        {
+            p = malloc((size_t) tl);
+            if ((NULL != p) && (1U != fread(p, (size_t) tl, 1U, fp)))
+            {
+                free(p);
+                p = NULL;
+            }
+        }
+        fclose(fp);
+    }
+    *pLen = (NULL != p) ? (uint32_t) tl : 0U;
+    return p;
+}
+
+/* Reads ChipID and versions, like ipf.c only the first string of each type counts. Returns 0 if the IPF is invalid. */
+static int read_versions(Member_t* m)
+{
+    uint32_t offset = HEADER_LEN;
+    uint32_t size, n, i, pid;
+    uint32_t meta = 0U, metaSize = 0U;
+    uint8_t  fw = 0U, cs = 0U;
+    uint8_t  fwVer[3], csVer[3];
+    const uint8_t* item;
+
+    if ((0 == memcmp(m->data, "IPZ", 3U)) || (0 == memcmp(m->data, "IPB", 3U)))
+    {
+        return 0; /* Members have to be plain IPF files */
+    }
+    while (offset < m->len)
+    {
+        if ((m->len - offset) < STRHDR_LEN)
+        {
+            return 0;
+        }
+        size = get32(&m->data[offset + 6U]);
+        if ((m->len - offset - STRHDR_LEN) < size)
+        {
+            return 0;
+        }
+        switch (m->data[offset])
+        {
+            case STRINGTYPE_FW:   fw = 1U; break;
+            case STRINGTYPE_CS:   cs = 1U; break;
+            case STRINGTYPE_META:
+                if (0U == metaSize)
+                {
+                    meta     = offset + STRHDR_LEN;
+                    metaSize = size;
+                }
+                break;
+            default: break;
+        }
+        offset += STRHDR_LEN + size;
+    }
+    memset(fwVer, 0xFF, sizeof(fwVer));
+    memset(csVer, 0xFF, sizeof(csVer));
+    n = (metaSize >= 4U) ? get32(&m->data[meta]) : 0U;
+    for (i = 0U; (i < n) && ((4U + ((i + 1U) * METAITEM_LEN)) <= metaSize); i++)
+    {
+        item = &m->data[meta + 4U + (i * METAITEM_LEN)];
+        pid  = get32(item);
+        if ((pid >= 0x200U) && (pid <= 0x202U)) /* FwMajorVersion...FwReleaseVersion */
+        {
+            fwVer[pid - 0x200U] = item[11];
+        }
+        else if ((pid >= 0x601U) && (pid <= 0x603U)) /* CfgsCustMajorVersion...CfgsCustReleaseVersion */
+        {
+            csVer[pid - 0x601U] = item[11];
+        }
+    }
+    m->ver[0] = m->data[1];
+    memset(&m->ver[1], 0xFF, 6U);
+    if (0U != fw)
+    {
+        memcpy(&m->ver[1], fwVer, 3U);
+    }
+    if (0U != cs)
+    {
+        memcpy(&m->ver[4], csVer, 3U);
+    }
+    return 1;
+}
+
+/* Ascending ChipID, then the newest versions first. */
+static int cmp_member(const void* a, const void* b)
+{
+    const Member_t* ma = (const Member_t*) a;
+    const Member_t* mb = (const Member_t*) b;
+    int i;
+    if (ma->ver[0] != mb->ver[0])
+    {
+        return (int) ma->ver[0] - (int) mb->ver[0];
+    }
+    for (i = 1; i < 7; i++)
+    {
+        if (ma->ver[i] != mb->ver[i])
+        {
+            return (int) mb->ver[i] - (int) ma->ver[i];
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Member_t* m;
+    uint8_t*  ipb;
+    uint32_t  n, i, lIpb, pos, e;
+    uint8_t   chip;
+    FILE*     fp;
+
+    n = (argc > 2) ? (uint32_t) (argc - 2) : 0U;
+    if ((0U == n) || (n > IPB_MAX_MEMBERS))
+    {
+        printf("Usage: %s output.ipb input.ipf...\n", argv[0]);
+        printf("  Packs 1...%u IPF files of one or several INICs into a bundle\n", IPB_MAX_MEMBERS);
+        return 1;
+    }
+    m    = calloc(n, sizeof(Member_t));
+    lIpb = IPB_HEADER_LEN + (n * IPB_ENTRY_LEN);
+    if (NULL == m)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    for (i = 0U; i < n; i++)
+    {
+        m[i].file = argv[i + 2U];
+        m[i].data = load_file(m[i].file, &m[i].len);
+        if (NULL == m[i].data)
+        {
+            printf("File %s could not be loaded\n", m[i].file);
+            return 1;
+        }
+        if (0 == read_versions(&m[i]))
+        {
+            printf("File %s is no valid IPF file\n", m[i].file);
+            return 1;
+        }
+        if ((0xFFFFFFFFU - lIpb) < m[i].len)
+        {
+            printf("Bundle exceeds 4 GB\n");
+            return 1;
+        }
+        lIpb += m[i].len;
+    }
+    qsort(m, n, sizeof(Member_t), cmp_member);
+    for (i = 1U; i < n; i++)
+    {
+        if (0 == cmp_member(&m[i - 1U], &m[i]))
+        {
+            printf("Warning: %s and %s have the same ChipID and versions, only the first one is selected\n",
+                   m[i - 1U].file, m[i].file);
+        }
+    }
+    ipb = calloc(lIpb, 1U);
+    if (NULL == ipb)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    ipb[0] = 'I';
+    ipb[1] = 'P';
+    ipb[2] = 'B';
+    ipb[3] = IPB_VERSION;
+    put32(&ipb[4], lIpb);
+    put32(&ipb[8], n);
+    pos = IPB_HEADER_LEN + (n * IPB_ENTRY_LEN);
+    for (i = 0U; i < n; i++)
+    {
+        chip = m[i].ver[0];
+        if (0U == ipb[17U + (2U * chip)]) /* First member of this ChipID */
+        {
+            ipb[16U + (2U * chip)] = (uint8_t) i;
+        }
+        ipb[17U + (2U * chip)]++;
+        e = IPB_HEADER_LEN + (i * IPB_ENTRY_LEN);
+        memcpy(&ipb[e], m[i].ver, 7U);
+        put32(&ipb[e + 8U],  pos);
+        put32(&ipb[e + 12U], m[i].len);
+        memcpy(&ipb[pos], m[i].data, m[i].len);
+        printf("ChipID 0x%02X  FW %3u.%3u.%3u  CFGS %3u.%3u.%3u  %8u bytes  %s\n", chip,
+               m[i].ver[1], m[i].ver[2], m[i].ver[3], m[i].ver[4], m[i].ver[5], m[i].ver[6], m[i].len, m[i].file);
+        pos += m[i].len;
+    }
+    fp = fopen(argv[1], "wb");
+    if ((NULL == fp) || (1U != fwrite(ipb, lIpb, 1U, fp)))
+    {
+        printf("File %s could not be written\n", argv[1]);
+        return 1;
+    }
+    fclose(fp);
+    printf("%u members -> %s: %u bytes\n", n, argv[1], lIpb);
+    for (i = 0U; i < n; i++)
+    {
+        free(m[i].data);
+    }
+    free(ipb);
+    free(m);
+    return 0;
+}
@@ -0,0 +1,869 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipfcheck.c
+ *  \brief  Host tool that validates IPF files in bulk, the IPF data is parsed with ipf.c of IPL
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ *
+ *  Build: gcc -std=gnu99 -O2 -I../../ipl/inc -I../../ipl/cfg -DIPL_USE_OS81110 -DIPL_USE_OS81092
+ *         -DIPL_USE_OS81082 -DIPL_USE_OS81060 -DIPL_USE_OS81050 -o ipfcheck ipfcheck.c ../../ipl/src/ipf.c
+ *  The -D flags enable the legacy INICs that ipl_cfg.h leaves out, so their default Meta data is known.
+ *  Usage: ipfcheck [-j Jobs] path...
+ *  Directories are searched recursively for *.ipf files, files given by name are always checked.
+ *  The files are split among Jobs worker processes (default: number of cores).
+ *  One JSON object per file is written to stdout in the order of the file list, a summary goes
+ *  to stderr. The exit code is 1 if any file has an error. An INIC that is not enabled in the
+ *  build is only reported as warning.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "ipl_cfg.h"
+#include "ipl.h"
+#include "ipf.h"
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define MAX_JOBS        64U
+#define MAX_ISSUES      64U     /* Per file, further issues are only counted */
+#define HEADER_LEN      6U      /* IPF file header, ChipID at offset 1 */
+#define STRHDR_LEN      10U     /* String header: type, reserved, address, size */
+#define METAITEM_LEN    12U
+#define CHIP_UNKNOWN    0U      /* ChipID is no INIC supported by IPL */
+#define CHIP_DISABLED   1U      /* INIC is supported by IPL, but not enabled in this build */
+#define CHIP_ENABLED    2U
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* TYPES                                                                                          */
+/*------------------------------------------------------------------------------------------------*/
+
+typedef struct Buf_
+{
+    char*    p;
+    size_t   len;
+    size_t   cap;
+} Buf_t;
+
+typedef struct Report_
+{
+    Buf_t    issues;
+    uint32_t nErr;
+    uint32_t nWarn;
+} Report_t;
+
+typedef struct Worker_
+{
+    int      fd;
+    pid_t    pid;
+    Buf_t    in;
+} Worker_t;
+
+/* First string of each type, all headers are walked, not only up to the first of each type as by ipf.c */
+typedef struct Strings_
+{
+    uint8_t  found[STRINGTYPE_MAX + 1U];
+    uint32_t offset[STRINGTYPE_MAX + 1U];
+    uint32_t size[STRINGTYPE_MAX + 1U];
+    uint32_t addr[STRINGTYPE_MAX + 1U];
+} Strings_t;
+
+/* PType expected for each MetaID, same as checked by Ipl_SetStdMetaProps() */
+typedef struct MetaType_
+{
+    uint32_t id;
+    uint8_t  type;
+} MetaType_t;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* VARIABLES                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static const MetaType_t MetaTypes[] =
+{
+    { METAID_CHIPID,                   METATYPE_UINT8  },
+    { METAID_CHIPPRGMEMSIZE,           METATYPE_UINT32 },
+    { METAID_CHIPPRGMEMPAGESIZE,       METATYPE_UINT32 },
+    { METAID_CHIPPRGMEMSECTIONSIZE,    METATYPE_UINT16 },
+    { METAID_CHIPNUMOFINFOMEMSECTIONS, METATYPE_UINT8  },
+    { METAID_CHIPINFOMEMSECTIONSIZE,   METATYPE_UINT16 },
+    { METAID_CHIPTESTMEMSIZE,          METATYPE_UINT16 },
+    { METAID_CHIPCOMBINEDCFGSTARTADDR, METATYPE_UINT32 },
+    { METAID_CHIPCOMBINEDCFGSIZE,      METATYPE_UINT16 },
+    { METAID_FWMAJORVERSION,           METATYPE_UINT8  },
+    { METAID_FWMINORVERSION,           METATYPE_UINT8  },
+    { METAID_FWRELEASEVERSION,         METATYPE_UINT8  },
+    { METAID_FWBUILDVERSION,           METATYPE_UINT32 },
+    { METAID_FWSIZE,                   METATYPE_UINT32 },
+    { METAID_FWSTARTADDR,              METATYPE_UINT32 },
+    { METAID_BMSIZE,                   METATYPE_UINT16 },
+    { METAID_BMMAXDATALENGTH,          METATYPE_UINT16 },
+    { METAID_CFGSFORMATVERSION,        METATYPE_UINT8  },
+    { METAID_CFGSCUSTMAJORVERSION,     METATYPE_UINT8  },
+    { METAID_CFGSCUSTMINORVERSION,     METATYPE_UINT8  },
+    { METAID_CFGSCUSTRELEASEVERSION,   METATYPE_UINT8  },
+    { METAID_CFGSSIZE,                 METATYPE_UINT16 },
+    { METAID_CFGSDEFSTARTADDR,         METATYPE_UINT32 },
+    { METAID_CFGSSTDSTARTADDR,         METATYPE_UINT32 },
+    { METAID_CFGSOVRLSTARTADDR,        METATYPE_UINT32 },
+    { METAID_CFGSTESTSTARTADDR,        METATYPE_UINT32 },
+    { METAID_IDENTSFORMATVERSION,      METATYPE_UINT8  },
+    { METAID_IDENTSSIZE,               METATYPE_UINT16 },
+    { METAID_IDENTSSTDSTARTADDR,       METATYPE_UINT32 },
+    { METAID_IDENTSOVRLSTARTADDR,      METATYPE_UINT32 },
+    { METAID_IDENTSTESTSTARTADDR,      METATYPE_UINT32 },
+    { METAID_PATCHSSIZE,               METATYPE_UINT16 },
+    { METAID_PATCHSSTDSTARTADDR,       METATYPE_UINT32 },
+    { METAID_PATCHSTESTSTARTADDR,      METATYPE_UINT32 },
+    { METAID_TOOLTYPE,                 METATYPE_STRING },
+    { METAID_TOOLMAJORVERSION,         METATYPE_UINT8  },
+    { METAID_TOOLMINORVERSION,         METATYPE_UINT8  },
+    { METAID_TOOLRELEASEVERSION,       METATYPE_UINT8  },
+    { METAID_TOOLBUILDVERSION,         METATYPE_UINT32 }
+};
+
+/* All INICs supported by IPL, see chip_ids in ipl_pb.h */
+static const uint8_t Chips[] =
+{
+    IPL_CHIP_OS81118, IPL_CHIP_OS81119, IPL_CHIP_OS81210, IPL_CHIP_OS81212, IPL_CHIP_OS81214,
+    IPL_CHIP_OS81216, IPL_CHIP_OS81110, IPL_CHIP_OS81092, IPL_CHIP_OS81082, IPL_CHIP_OS81060,
+    IPL_CHIP_OS81050
+};
+
+static char**   Files;
+static uint32_t NumOfFiles;
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* IPL FUNCTIONS NEEDED BY IPF.C, THE WHOLE IPF IS IN MEMORY                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+void Ipl_Trace(const char* tag, const char* fmt, ...)
+{
+    (void) tag;
+    (void) fmt;
+}
+
+char* Ipl_TraceTag(uint8_t result)
+{
+    return (IPL_RES_OK == result) ? IPL_TRACETAG_INFO : IPL_TRACETAG_ERR;
+}
+
+char Ipl_Bcd2Char(uint8_t val, uint8_t lowHigh)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    return (IPL_HIGH == lowHigh) ? hex[(val >> 4U) & 0x0FU] : hex[val & 0x0FU];
+}
+
+uint8_t Ipl_ClrPData(uint32_t lData, uint8_t pData[])
+{
+    (void) lData;
+    return (NULL == pData) ? IPL_RES_ERR_INVALID_DATACHUNK : IPL_RES_OK;
+}
+
+uint8_t Ipl_PData(uint32_t index, uint32_t lData, uint8_t pData[])
+{
+    return (index < lData) ? pData[index] : 0U;
+}
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+/* Makes room for n more bytes and the terminating zero */
+static void Chk_BufRoom(Buf_t* b, size_t n)
+{
+    if ((b->len + n + 1U) > b->cap)
+    {
+        b->cap = (b->len + n + 1U) * 2U;
+        b->p   = realloc(b->p, b->cap);
+        if (NULL == b->p)
+        {
+            fprintf(stderr, "Out of memory\n");
+            exit(2);
+        }
+    }
+}
+
+static void Chk_BufAdd(Buf_t* b, const char* fmt, ...)
+{
+    va_list ap;
+    int     n;
+    va_start(ap, fmt);
+    n = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    Chk_BufRoom(b, (size_t) n);
+    va_start(ap, fmt);
+    vsnprintf(&b->p[b->len], (size_t) n + 1U, fmt, ap);
+    va_end(ap);
+    b->len += (size_t) n;
+}
+
+/* Adds the string as quoted JSON string */
+static void Chk_BufStr(Buf_t* b, const char* s)
+{
+    Chk_BufAdd(b, "\"");
+    for (; '\0' != *s; s++)
+    {
+        if (('"' == *s) || ('\\' == *s))
+        {
+            Chk_BufAdd(b, "\\%c", *s);
+        }
+        else if ((unsigned char) *s < 0x20U)
+        {
+            Chk_BufAdd(b, "\\u%04x", (unsigned char) *s);
+        }
+        else
+        {
+            Chk_BufAdd(b, "%c", *s);
+        }
+    }
+    Chk_BufAdd(b, "\"");
+}
+
+static void Chk_Issue(Report_t* r, uint8_t isErr, const char* check, const char* fmt, ...)
+{
+    char    detail[160];
+    va_list ap;
+    if ((r->nErr + r->nWarn) < MAX_ISSUES)
+    {
+        va_start(ap, fmt);
+        vsnprintf(detail, sizeof(detail), fmt, ap);
+        va_end(ap);
+        Chk_BufAdd(&r->issues, "%s{\"level\":\"%s\",\"check\":\"%s\",\"detail\":", (0U != r->issues.len) ? "," : "",
+                   isErr ? "error" : "warning", check);
+        Chk_BufStr(&r->issues, detail);
+        Chk_BufAdd(&r->issues, "}");
+    }
+    if (isErr)
+    {
+        r->nErr++;
+    }
+    else
+    {
+        r->nWarn++;
+    }
+}
+
+static uint32_t Chk_Get32(const uint8_t* p)
+{
+    return ((uint32_t) p[0] << 24U) | ((uint32_t) p[1] << 16U) | ((uint32_t) p[2] << 8U) | (uint32_t) p[3];
+}
+
+/* Returns the PType expected for the MetaID, 0 if the MetaID is unknown */
+static uint8_t Chk_MetaType(uint32_t id)
+{
+    uint32_t i;
+    uint8_t  type = 0U;
+    for (i = 0U; (i < (sizeof(MetaTypes) / sizeof(MetaTypes[0]))) && (0U == type); i++)
+    {
+        if (id == MetaTypes[i].id)
+        {
+            type = MetaTypes[i].type;
+        }
+    }
+    return type;
+}
+
+/* Gets the default table of the chip, an IPF without META string makes ipf.c fall back to Ipl_SetDefaultMetaProps() */
+static uint8_t Chk_GetDefaults(uint8_t chip, Ipl_MetaData_t* pDef)
+{
+    Ipl_IpfData_t ctx;
+    uint8_t       ipf[STRING_MIN_LEN];
+    uint8_t       res;
+    uint32_t      i;
+    uint8_t       state = CHIP_UNKNOWN;
+    memset(ipf, 0, sizeof(ipf));
+    ipf[1] = chip;
+    Ipl_ClrIpfData(&ctx, chip);
+    res = Ipl_ParseIpf(&ctx, sizeof(ipf), ipf, STRINGTYPE_META);
+    *pDef = ctx.Meta;
+    if (IPL_RES_OK == res)
+    {
+        state = CHIP_ENABLED;
+    }
+    for (i = 0U; (i < sizeof(Chips)) && (CHIP_UNKNOWN == state); i++)
+    {
+        if (chip == Chips[i])
+        {
+            state = CHIP_DISABLED;
+        }
+    }
+    return state;
+}
+
+static void Chk_MetaItems(Report_t* r, const uint8_t* pData, uint32_t offset, uint32_t size)
+{
+    uint32_t n, i, pid, pval, plen;
+    uint8_t  ptype, exp;
+    const uint8_t* item;
+    if (size < 4U)
+    {
+        Chk_Issue(r, 1U, "meta_bounds", "META string with %u bytes has no item count", size);
+    }
+    else
+    {
+        n = Chk_Get32(&pData[offset + STRHDR_LEN]);
+        if ((((uint64_t) n * METAITEM_LEN) + 4U) > size)
+        {
+            Chk_Issue(r, 1U, "meta_bounds", "%u Meta items exceed the META string of %u bytes", n, size);
+        }
+        else
+        {
+            for (i = 0U; i < n; i++)
+            {
+                item  = &pData[offset + STRHDR_LEN + 4U + (i * METAITEM_LEN)];
+                pid   = Chk_Get32(&item[0]);
+                ptype = item[4];
+                plen  = ((uint32_t) item[5] << 16U) | ((uint32_t) item[6] << 8U) | (uint32_t) item[7];
+                pval  = Chk_Get32(&item[8]);
+                exp   = Chk_MetaType(pid);
+                if (0U == exp)
+                {
+                    Chk_Issue(r, 0U, "meta_id", "MetaID 0x%08X unknown", pid);
+                }
+                else if (ptype != exp)
+                {
+                    Chk_Issue(r, 1U, "meta_type", "MetaID 0x%08X has PType 0x%02X, 0x%02X expected", pid, ptype, exp);
+                }
+                if ((METATYPE_STRING == ptype) && (((uint64_t) pval + plen) > size))
+                {
+                    Chk_Issue(r, 1U, "meta_bounds", "MetaID 0x%08X string at %u with %u bytes exceeds the META string", pid, pval, plen);
+                }
+            }
+        }
+    }
+}
+
+/* Checks the bounds of all string headers and records the first string of each type */
+static void Chk_Strings(Report_t* r, const uint8_t* pData, uint32_t lData, Strings_t* s)
+{
+    uint32_t offset = HEADER_LEN;
+    uint32_t size;
+    uint8_t  type;
+    memset(s, 0, sizeof(*s));
+    while (offset < lData)
+    {
+        if ((lData - offset) < STRHDR_LEN)
+        {
+            Chk_Issue(r, 1U, "string_bounds", "%u bytes at offset %u are no complete string header", lData - offset, offset);
+            break;
+        }
+        type = pData[offset];
+        size = Chk_Get32(&pData[offset + 6U]);
+        if ((lData - offset - STRHDR_LEN) < size)
+        {
+            Chk_Issue(r, 1U, "string_bounds", "StringType 0x%02X at offset %u with %u bytes exceeds the IPF by %u bytes",
+                      type, offset, size, size - (lData - offset - STRHDR_LEN));
+            break;
+        }
+        if ((STRINGTYPE_MAX < type) || (0U == type) || (0x06U == type))
+        {
+            Chk_Issue(r, 0U, "string_type", "StringType 0x%02X at offset %u unknown", type, offset);
+        }
+        else if (0U != s->found[type])
+        {
+            Chk_Issue(r, 0U, "string_type", "StringType 0x%02X at offset %u is ignored, first one at offset %u", type, offset, s->offset[type]);
+        }
+        else
+        {
+            s->found[type]  = 1U;
+            s->offset[type] = offset;
+            s->size[type]   = size;
+            s->addr[type]   = Chk_Get32(&pData[offset + 2U]);
+        }
+        offset += STRHDR_LEN + size;
+    }
+}
+
+static void Chk_Ipf(Report_t* r, uint8_t* pData, uint32_t lData)
+{
+    Ipl_IpfData_t  ctx;
+    Ipl_MetaData_t def, meta;
+    Strings_t      s;
+    uint32_t prgMemSize;
+    uint8_t  type, res, chip, chipState, isErr;
+
+    if (lData < STRING_MIN_LEN)
+    {
+        Chk_Issue(r, 1U, "header", "IPF has %u bytes, at least %u expected", lData, STRING_MIN_LEN);
+    }
+    else
+    {
+        chip      = pData[1];
+        chipState = Chk_GetDefaults(chip, &def);
+        if (CHIP_UNKNOWN == chipState)
+        {
+            Chk_Issue(r, 1U, "chip", "ChipID 0x%02X unknown", chip);
+        }
+        else if (CHIP_DISABLED == chipState)
+        {
+            Chk_Issue(r, 0U, "chip", "ChipID 0x%02X is not enabled in this build, its default Meta data is not checked", chip);
+        }
+        if (CHIP_ENABLED != chipState)
+        {
+            memset(&def, 0xFF, sizeof(def)); /* No default table, all values DEFAULTVAL */
+        }
+        Chk_Strings(r, pData, lData, &s);
+
+        /* Verdict of ipf.c for each string, META first so the Meta data is kept */
+        Ipl_ClrIpfData(&ctx, chip);
+        res  = Ipl_ParseIpf(&ctx, lData, pData, STRINGTYPE_META);
+        meta = ctx.Meta;
+        if (IPL_RES_OK != res)
+        {
+            /* Without META string only the default table of a disabled INIC is missing */
+            isErr = ((CHIP_DISABLED == chipState) && (IPL_RES_ERR_IPF_WRONGINIC == res)) ? 0U : 1U;
+            Chk_Issue(r, isErr, "parse", "Ipl_ParseIpf returned 0x%02X for StringType 0x%02X", res, STRINGTYPE_META);
+        }
+        for (type = 1U; type <= STRINGTYPE_MAX; type++)
+        {
+            if ((0U != s.found[type]) && (STRINGTYPE_META != type))
+            {
+                res = Ipl_ParseIpf(&ctx, lData, pData, type);
+                if (IPL_RES_OK != res)
+                {
+                    Chk_Issue(r, 1U, "parse", "Ipl_ParseIpf returned 0x%02X for StringType 0x%02X", res, type);
+                }
+            }
+        }
+
+        /* Meta types, Ipl_CheckMetaPType() only traces them */
+        if (0U != s.found[STRINGTYPE_META])
+        {
+            Chk_MetaItems(r, pData, s.offset[STRINGTYPE_META], s.size[STRINGTYPE_META]);
+            if ((DEFAULTVAL_UINT8 != meta.ChipID) && (chip != meta.ChipID))
+            {
+                Chk_Issue(r, 1U, "meta_chip", "Meta ChipID 0x%02X differs from ChipID 0x%02X in the header", meta.ChipID, chip);
+            }
+        }
+        else
+        {
+            Chk_Issue(r, 0U, "meta", "No META string, the default table of ChipID 0x%02X is used", chip);
+        }
+
+        /* Firmware size */
+        prgMemSize = meta.ChipPrgMemSize;
+        if (DEFAULTVAL_UINT32 == prgMemSize)
+        {
+            prgMemSize = def.ChipPrgMemSize;
+        }
+        if ((0U != s.found[STRINGTYPE_FW]) && (DEFAULTVAL_UINT32 != prgMemSize) &&
+            (((uint64_t) s.addr[STRINGTYPE_FW] + s.size[STRINGTYPE_FW]) > prgMemSize))
+        {
+            Chk_Issue(r, 1U, "fw_size", "FW with %u bytes at 0x%X exceeds ChipPrgMemSize 0x%X",
+                      s.size[STRINGTYPE_FW], s.addr[STRINGTYPE_FW], prgMemSize);
+        }
+
+        /* Configuration sizes, IPL programs as many bytes as the Meta data refers */
+        if (0U != s.found[STRINGTYPE_CS])
+        {
+            if ((DEFAULTVAL_UINT32 != meta.CfgsSize) && (s.size[STRINGTYPE_CS] != meta.CfgsSize))
+            {
+                Chk_Issue(r, 1U, "cfg_size", "CS has %u bytes, Meta CfgsSize is %u", s.size[STRINGTYPE_CS], meta.CfgsSize);
+            }
+            if ((DEFAULTVAL_UINT32 != def.CfgsSize) && (s.size[STRINGTYPE_CS] != def.CfgsSize))
+            {
+                Chk_Issue(r, 1U, "cfg_size", "CS has %u bytes, default CfgsSize of ChipID 0x%02X is %u", s.size[STRINGTYPE_CS], chip, def.CfgsSize);
+            }
+        }
+        if (0U != s.found[STRINGTYPE_IS])
+        {
+            if ((DEFAULTVAL_UINT32 != meta.IdentsSize) && (s.size[STRINGTYPE_IS] != meta.IdentsSize))
+            {
+                Chk_Issue(r, 1U, "cfg_size", "IS has %u bytes, Meta IdentsSize is %u", s.size[STRINGTYPE_IS], meta.IdentsSize);
+            }
+            if ((DEFAULTVAL_UINT32 != def.IdentsSize) && (s.size[STRINGTYPE_IS] != def.IdentsSize))
+            {
+                Chk_Issue(r, 1U, "cfg_size", "IS has %u bytes, default IdentsSize of ChipID 0x%02X is %u", s.size[STRINGTYPE_IS], chip, def.IdentsSize);
+            }
+        }
+    }
+}
+
+static uint8_t* Chk_LoadFile(const char* fileName, uint32_t* pLen)
+{
+    FILE*    fp;
+    long     len;
+    uint8_t* p = NULL;
+    fp = fopen(fileName, "rb");
+    if (NULL != fp)
+    {
+        if ((0 == fseek(fp, 0, SEEK_END)) && (0 <= (len = ftell(fp))) && ((long) UINT32_MAX > len) &&
+            (0 == fseek(fp, 0, SEEK_SET)))
+        {
+            p = malloc((size_t) len + 1U);
+            if ((NULL != p) && (0 < len) && (1U != fread(p, (size_t) len, 1U, fp)))
+            {
+                free(p);
+                p = NULL;
+            }
+            *pLen = (uint32_t) len;
+        }
+        fclose(fp);
+    }
+    return p;
+}
+
+/* Writes one JSON line for the file into out, returns 1 if the file has an error */
+static uint8_t Chk_File(const char* fileName, Buf_t* out)
+{
+    Report_t r;
+    uint8_t* pData;
+    uint32_t lData = 0U;
+    uint8_t  chip  = 0U;
+    memset(&r, 0, sizeof(r));
+    Chk_BufAdd(&r.issues, "");
+    pData = Chk_LoadFile(fileName, &lData);
+    if (NULL == pData)
+    {
+        Chk_Issue(&r, 1U, "io", "File could not be read");
+    }
+    else
+    {
+        chip = (HEADER_LEN <= lData) ? pData[1] : 0U;
+        Chk_Ipf(&r, pData, lData);
+        free(pData);
+    }
+    Chk_BufAdd(out, "{\"ok\":%s,\"file\":", (0U == r.nErr) ? "true" : "false");
+    Chk_BufStr(out, fileName);
+    Chk_BufAdd(out, ",\"size\":%u,\"chip\":\"0x%02X\",\"errors\":%u,\"warnings\":%u,\"issues\":[%s]}\n",
+               lData, chip, r.nErr, r.nWarn, r.issues.p);
+    free(r.issues.p);
+    return (0U == r.nErr) ? 0U : 1U;
+}
+
+static void Chk_AddFile(const char* path)
+{
+    Files = realloc(Files, (NumOfFiles + 1U) * sizeof(char*));
+    if ((NULL == Files) || (NULL == (Files[NumOfFiles] = strdup(path))))
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(2);
+    }
+    NumOfFiles++;
+}
+
+static void Chk_AddPath(const char* path, uint8_t named)
+{
+    struct stat    st;
+    struct dirent* de;
+    DIR*           dir;
+    Buf_t          child = { NULL, 0U, 0U };
+    size_t         len;
+    if ((0 != (named ? stat(path, &st) : lstat(path, &st))))
+    {
+        if (named)
+        {
+            Chk_AddFile(path); /* Reported as not readable */
+        }
+    }
+    else if (S_ISDIR(st.st_mode))
+    {
+        dir = opendir(path);
+        if (NULL == dir)
+        {
+            fprintf(stderr, "Directory %s could not be opened\n", path);
+        }
+        else
+        {
+            while (NULL != (de = readdir(dir)))
+            {
+                if ((0 != strcmp(de->d_name, ".")) && (0 != strcmp(de->d_name, "..")))
+                {
+                    child.len = 0U;
+                    len = strlen(path);
+                    Chk_BufAdd(&child, "%s%s%s", path, ((0U < len) && ('/' == path[len - 1U])) ? "" : "/", de->d_name);
+                    Chk_AddPath(child.p, 0U);
+                }
+            }
+            closedir(dir);
+            free(child.p);
+        }
+    }
+    else if (named)
+    {
+        Chk_AddFile(path);
+    }
+    else
+    {
+        len = strlen(path);
+        if ((4U <= len) && (0 == strcasecmp(&path[len - 4U], ".ipf")) &&
+            (S_ISREG(st.st_mode) || (S_ISLNK(st.st_mode) && (0 == stat(path, &st)) && S_ISREG(st.st_mode))))
+        {
+            Chk_AddFile(path);
+        }
+    }
+}
+
+static int Chk_CmpPath(const void* a, const void* b)
+{
+    return strcmp(*(const char* const*) a, *(const char* const*) b);
+}
+
+/* Checks every jobs-th file, each line is prefixed with the index of the file */
+static void Chk_RunWorker(int fd, uint32_t first, uint32_t jobs)
+{
+    Buf_t    out = { NULL, 0U, 0U };
+    uint32_t i;
+    size_t   done;
+    ssize_t  n;
+    int      failed = 0;
+    for (i = first; i < NumOfFiles; i += jobs)
+    {
+        out.len = 0U;
+        Chk_BufAdd(&out, "%u\t", i);
+        failed |= Chk_File(Files[i], &out);
+        for (done = 0U; done < out.len; done += (size_t) n)
+        {
+            n = write(fd, &out.p[done], out.len - done);
+            if (0 >= n)
+            {
+                _exit(2);
+            }
+        }
+    }
+    _exit(failed);
+}
+
+/* Forks the workers, returns the number of workers started */
+static uint32_t Chk_StartWorkers(Worker_t workers[], uint32_t jobs)
+{
+    uint32_t w;
+    int      fds[2];
+    uint8_t  ok = 1U;
+    for (w = 0U; (w < jobs) && (0U != ok); w++)
+    {
+        ok = 0U;
+        if (0 != pipe(fds))
+        {
+            fprintf(stderr, "Pipe could not be created\n");
+        }
+        else
+        {
+            workers[w].pid = fork();
+            if (0 == workers[w].pid)
+            {
+                close(fds[0]);
+                Chk_RunWorker(fds[1], w, jobs);
+            }
+            close(fds[1]);
+            if (0 > workers[w].pid)
+            {
+                fprintf(stderr, "Worker could not be started\n");
+                close(fds[0]);
+            }
+            else
+            {
+                workers[w].fd     = fds[0];
+                workers[w].in.p   = NULL;
+                workers[w].in.len = 0U;
+                workers[w].in.cap = 0U;
+                ok = 1U;
+            }
+        }
+    }
+    return (0U != ok) ? w : (w - 1U);
+}
+
+/* Reads what the worker has written and stores its complete lines, returns 0 when the worker is done */
+static uint8_t Chk_ReadWorker(Worker_t* pWorker, char** lines)
+{
+    ssize_t  n;
+    uint32_t i;
+    char*    nl;
+    char*    line;
+    uint8_t  open = 0U;
+    Chk_BufRoom(&pWorker->in, 4096U);
+    n = read(pWorker->fd, &pWorker->in.p[pWorker->in.len], 4096U);
+    if (0 >= n)
+    {
+        close(pWorker->fd);
+        pWorker->fd = -1;
+    }
+    else
+    {
+        open = 1U;
+        pWorker->in.len += (size_t) n;
+        pWorker->in.p[pWorker->in.len] = '\0';
+        line = pWorker->in.p;
+        while (NULL != (nl = strchr(line, '\n')))
+        {
+            *nl = '\0';
+            i = (uint32_t) strtoul(line, &line, 10);
+            if (i < NumOfFiles)
+            {
+                lines[i] = strdup(line + 1);
+            }
+            line = nl + 1;
+        }
+        pWorker->in.len -= (size_t) (line - pWorker->in.p);
+        memmove(pWorker->in.p, line, pWorker->in.len + 1U);
+    }
+    return open;
+}
+
+/* Collects the lines of all workers, they are written in the order of the file list. Returns the number of failed files. */
+static uint32_t Chk_CollectLines(Worker_t workers[], uint32_t jobs, char** lines, uint32_t* pNext)
+{
+    struct pollfd pfd[MAX_JOBS];
+    uint32_t w;
+    uint32_t open   = jobs;
+    uint32_t failed = 0U;
+    while (0U < open)
+    {
+        for (w = 0U; w < jobs; w++)
+        {
+            pfd[w].fd     = workers[w].fd;
+            pfd[w].events = POLLIN;
+        }
+        if (0 <= poll(pfd, jobs, -1))
+        {
+            for (w = 0U; w < jobs; w++)
+            {
+                if ((0 <= pfd[w].fd) && (0 != (pfd[w].revents & (POLLIN | POLLHUP | POLLERR))) &&
+                    (0U == Chk_ReadWorker(&workers[w], lines)))
+                {
+                    open--;
+                }
+            }
+        }
+        while ((*pNext < NumOfFiles) && (NULL != lines[*pNext]))
+        {
+            if (0 == strncmp(lines[*pNext], "{\"ok\":false", 11U))
+            {
+                failed++;
+            }
+            printf("%s\n", lines[*pNext]);
+            free(lines[*pNext]);
+            lines[*pNext] = NULL;
+            (*pNext)++;
+        }
+        fflush(stdout);
+    }
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    Worker_t   workers[MAX_JOBS];
+    char**     lines;
+    long       cores;
+    uint32_t   jobs, i, w, started, next = 0U, failed = 0U;
+    int        argi = 1, status, res = 0;
+
+    cores = sysconf(_SC_NPROCESSORS_ONLN);
+    jobs  = (0 < cores) ? (uint32_t) cores : 1U;
+    if ((3 <= argc) && (0 == strcmp(argv[1], "-j")))
+    {
+        jobs = (uint32_t) strtoul(argv[2], NULL, 0);
+        argi = 3;
+    }
+    if ((argi >= argc) || (0U == jobs))
+    {
+        printf("Usage: %s [-j Jobs] path...\n", argv[0]);
+        printf("  Checks the IPF files and all *.ipf files in the directories, Jobs defaults to the number of cores\n");
+        res = 2;
+    }
+    else
+    {
+        for (; argi < argc; argi++)
+        {
+            Chk_AddPath(argv[argi], 1U);
+        }
+        qsort(Files, NumOfFiles, sizeof(char*), Chk_CmpPath);
+        if (MAX_JOBS < jobs)
+        {
+            jobs = MAX_JOBS;
+        }
+        if (NumOfFiles < jobs)
+        {
+            jobs = (0U < NumOfFiles) ? NumOfFiles : 1U;
+        }
+        lines = calloc(NumOfFiles + 1U, sizeof(char*));
+        if (NULL == lines)
+        {
+            fprintf(stderr, "Out of memory\n");
+            res = 2;
+        }
+        else
+        {
+            fflush(stdout);
+            started = Chk_StartWorkers(workers, jobs);
+            if (started == jobs)
+            {
+                failed = Chk_CollectLines(workers, jobs, lines, &next);
+            }
+            else
+            {
+                for (w = 0U; w < started; w++)
+                {
+                    close(workers[w].fd); /* Worker stops when it cannot write */
+                }
+                res = 2;
+            }
+            for (w = 0U; w < started; w++)
+            {
+                if ((workers[w].pid != waitpid(workers[w].pid, &status, 0)) || !WIFEXITED(status) ||
+                    (1 < WEXITSTATUS(status)))
+                {
+                    res = 2;
+                }
+                free(workers[w].in.p);
+            }
+            if ((0 == res) && (next < NumOfFiles))
+            {
+                fprintf(stderr, "%u files were not reported\n", NumOfFiles - next);
+                res = 2;
+            }
+            fprintf(stderr, "%u files checked by %u workers, %u failed\n", next, jobs, failed);
+            for (i = 0U; i < NumOfFiles; i++)
+            {
+                free(lines[i]);
+            }
+            free(lines);
+        }
+        for (i = 0U; i < NumOfFiles; i++)
+        {
+            free(Files[i]);
+        }
+        free(Files);
+        if ((0 == res) && (0U < failed))
+        {
+            res = 1;
+        }
+    }
+    return res;
+}
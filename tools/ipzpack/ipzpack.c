@@ -0,0 +1,238 @@
+/*------------------------------------------------------------------------------------------------*/
+/* (c) 2018 Microchip Technology Inc. and its subsidiaries.                                       */
+/*                                                                                                */
+/* You may use this software and any derivatives exclusively with Microchip products.             */
+/*                                                                                                */
+/* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR    */
+/* STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,       */
+/* MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP       */
+/* PRODUCTS, COMBINATION WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.                      */
+/*                                                                                                */
+/* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR        */
+/* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE,    */
+/* HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE       */
+/* FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS   */
+/* IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE  */
+/* PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.                                                  */
+/*                                                                                                */
+/* MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE TERMS.            */
+/*------------------------------------------------------------------------------------------------*/
+
+/*! \file   ipzpack.c
+ *  \brief  Host tool that packs an IPF file into a compressed IPZ container (see ipl_ipz.h)
+ *  \author Roland Trissl (RTR)
+ *  \note   For support related to this code contact http://www.microchip.com/support.
+ *
+ *  Build: gcc -std=gnu99 -O2 -o ipzpack ipzpack.c
+ *  Usage: ipzpack input.ipf output.ipz [BlockSize]
+ *  The block size has to be equal to IPL_DATACHUNK_SIZE of the target (default 2048).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* CONSTANTS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+#define IPZ_VERSION     0x01U
+#define IPZ_HEADER_LEN  24U
+#define BLOCK_DEFAULT   2048U
+#define BLOCK_MIN       2048U
+#define BLOCK_MAX       65536U  /* LZ4 match distances are 16 bit */
+#define HASH_BITS       12U
+#define MINMATCH        4U
+#define LASTLITERALS    5U      /* LZ4: the last 5 bytes are always literals */
+#define MFLIMIT         12U     /* LZ4: the last match starts at least 12 bytes before the end */
+
+
+/*------------------------------------------------------------------------------------------------*/
+/* FUNCTIONS                                                                                      */
+/*------------------------------------------------------------------------------------------------*/
+
+static void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t) (v >> 24);
+    p[1] = (uint8_t) (v >> 16);
+    p[2] = (uint8_t) (v >>  8);
+    p[3] = (uint8_t)  v;
+}
+
+static uint32_t read32(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+static uint32_t put_len(uint8_t* dst, uint32_t out, uint32_t len)
+{
+    while (len >= 255U)
+    {
+        dst[out++] = 255U;
+        len -= 255U;
+    }
+    dst[out++] = (uint8_t) len;
+    return out;
+}
+
+/* Compresses one block in the LZ4 block format (greedy, one hash candidate). Returns the compressed length. */
+static uint32_t compress_block(const uint8_t* src, uint32_t len, uint8_t* dst)
+{
+    int32_t  table[1U << HASH_BITS];
+    uint32_t pos    = 0U;
+    uint32_t anchor = 0U;
+    uint32_t out    = 0U;
+    uint32_t h, cand, mlen, lit;
+    int32_t  prev;
+    uint8_t* token;
+
+    memset(table, 0xFF, sizeof table);
+    while ((len > MFLIMIT) && (pos <= (len - MFLIMIT)))
+    {
+        h        = (read32(&src[pos]) * 2654435761U) >> (32U - HASH_BITS);
+        prev     = table[h];
+        table[h] = (int32_t) pos;
+        cand     = (uint32_t) prev;
+        if ((prev >= 0) && ((pos - cand) < 65536U) && (read32(&src[cand]) == read32(&src[pos])))
+        {
+            mlen = MINMATCH;
+            while (((pos + mlen) < (len - LASTLITERALS)) && (src[cand + mlen] == src[pos + mlen]))
+            {
+                mlen++;
+            }
+            lit    = pos - anchor;
+            token  = &dst[out++];
+            *token = (uint8_t) (((lit < 15U) ? lit : 15U) << 4);
+            if (lit >= 15U)
+            {
+                out = put_len(dst, out, lit - 15U);
+            }
+            memcpy(&dst[out], &src[anchor], lit);
+            out += lit;
+            dst[out++] = (uint8_t)  (pos - cand);
+            dst[out++] = (uint8_t) ((pos - cand) >> 8);
+            *token |= (uint8_t) (((mlen - MINMATCH) < 15U) ? (mlen - MINMATCH) : 15U);
+            if ((mlen - MINMATCH) >= 15U)
+            {
+                out = put_len(dst, out, mlen - MINMATCH - 15U);
+            }
+            pos   += mlen;
+            anchor = pos;
+        }
+        else
+        {
+            pos++;
+        }
+    }
+    lit        = len - anchor; /* Last sequence, literals only */
+    dst[out++] = (uint8_t) (((lit < 15U) ? lit : 15U) << 4);
+    if (lit >= 15U)
+    {
+        out = put_len(dst, out, lit - 15U);
+    }
+    memcpy(&dst[out], &src[anchor], lit);
+    out += lit;
+    return out;
+}
+
+static uint8_t* load_file(const char* fileName, uint32_t* pLen)
+{
+    uint8_t* p  = NULL;
+    long     tl = -1;
+    FILE*    fp = fopen(fileName, "rb");
+    if (NULL != fp)
+    {
+        fseek(fp, 0, SEEK_END);
+        tl = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        if ((tl > 6) && (tl <= 0x7FFFFFFFL))
+        {
+            p = malloc((size_t) tl);
+            if ((NULL != p) && (1U != fread(p, (size_t) tl, 1U, fp)))
+            {
+                free(p);
+                p = NULL;
+            }
+        }
+        fclose(fp);
+    }
+    *pLen = (NULL != p) ? (uint32_t) tl : 0U;
+    return p;
+}
+
+int main(int argc, char** argv)
+{
+    uint8_t* ipf;
+    uint8_t* ipz;
+    uint8_t* blk;
+    uint32_t lIpf, lIpz, bs, n, i, start, lRaw, lCmp, stored = 0U;
+    FILE*    fp;
+
+    bs = (argc == 4) ? (uint32_t) strtoul(argv[3], NULL, 0) : BLOCK_DEFAULT;
+    if ((argc != 3 && argc != 4) || (bs < BLOCK_MIN) || (bs > BLOCK_MAX))
+    {
+        printf("Usage: %s input.ipf output.ipz [BlockSize]\n", argv[0]);
+        printf("  BlockSize has to be equal to IPL_DATACHUNK_SIZE (%u...%u, default %u)\n", BLOCK_MIN, BLOCK_MAX, BLOCK_DEFAULT);
+        return 1;
+    }
+    ipf = load_file(argv[1], &lIpf);
+    if (NULL == ipf)
+    {
+        printf("File %s could not be loaded\n", argv[1]);
+        return 1;
+    }
+    n   = ((lIpf - 1U) / bs) + 1U;
+    ipz = malloc(IPZ_HEADER_LEN + ((n + 1U) * 4U) + lIpf + (n * ((bs / 255U) + 16U)));
+    blk = malloc(bs + (bs / 255U) + 16U);
+    if ((NULL == ipz) || (NULL == blk))
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    memset(ipz, 0, IPZ_HEADER_LEN);
+    ipz[0] = 'I';
+    ipz[1] = 'P';
+    ipz[2] = 'Z';
+    ipz[3] = IPZ_VERSION;
+    put32(&ipz[4],  lIpf);
+    put32(&ipz[8],  bs);
+    put32(&ipz[12], n);
+    memcpy(&ipz[16], ipf, 6U); /* IPF file header, so the ChipID is visible without decompression */
+    lIpz = IPZ_HEADER_LEN + ((n + 1U) * 4U);
+    for (i = 0U; i < n; i++)
+    {
+        start = i * bs;
+        lRaw  = ((lIpf - start) < bs) ? (lIpf - start) : bs;
+        lCmp  = compress_block(&ipf[start], lRaw, blk);
+        put32(&ipz[IPZ_HEADER_LEN + (i * 4U)], lIpz);
+        if (lCmp < lRaw)
+        {
+            memcpy(&ipz[lIpz], blk, lCmp);
+            lIpz += lCmp;
+        }
+        else
+        {
+            memcpy(&ipz[lIpz], &ipf[start], lRaw); /* Same length as the original means stored */
+            lIpz += lRaw;
+            stored++;
+        }
+    }
+    put32(&ipz[IPZ_HEADER_LEN + (n * 4U)], lIpz);
+    fp = fopen(argv[2], "wb");
+    if ((NULL == fp) || (1U != fwrite(ipz, lIpz, 1U, fp)))
+    {
+        printf("File %s could not be written\n", argv[2]);
+        return 1;
+    }
+    fclose(fp);
+    printf("%s: %u bytes, %u blocks of %u bytes (%u stored) -> %s: %u bytes (%.1f%%)\n",
+           argv[1], lIpf, n, bs, stored, argv[2], lIpz, (100.0 * lIpz) / lIpf);
+    free(blk);
+    free(ipz);
+    free(ipf);
+    return 0;
+}